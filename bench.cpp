@@ -0,0 +1,795 @@
+
+/**
+ * @brief - Benchmarks for the hot paths of the simulation. Each
+ *          benchmark runs on synthetic worlds holding a given
+ *          number of entities (by default 1k, 10k and 100k) and
+ *          measures the duration of individual calls. Results
+ *          are written as JSON so that they can be compared from
+ *          a release to the next.
+ *
+ *          The following paths are covered:
+ *            - `Locator::getVisible` (rectangle and radius, with
+ *              and without filters and sorting).
+ *            - `Locator::obstructed` (point and segment).
+ *            - `AStar::findPath` on open and maze maps.
+ *            - `PheromonAnalyzer::computeTarget`.
+ *            - `World::processInfluences` with heavy churn.
+ *            - `World::step`, with and without reordering of
+ *              the elements by location.
+ *
+ *          Usage:
+ *            new_frontiers_bench [-o output] [-s seed] [-p 1000,10000]
+ *                                [-b budget] [-f filter] [-j threads]
+ */
+
+# include <chrono>
+# include <vector>
+# include <string>
+# include <memory>
+# include <fstream>
+# include <iomanip>
+# include <iostream>
+# include <algorithm>
+# include <functional>
+# include <core_utils/RNG.hh>
+# include <core_utils/log/StdLogger.hh>
+# include <core_utils/log/Locator.hh>
+# include <core_utils/log/PrefixedLogger.hh>
+# include <core_utils/CoreException.hh>
+# include "World.hh"
+# include "Logging.hh"
+# include "blocks/BlockFactory.hh"
+# include "colonies/ColonyFactory.hh"
+# include "entities/EntityFactory.hh"
+# include "entities/AStar.hh"
+# include "entities/PheromonAnalyzer.hh"
+# include "effects/PheromonFactory.hh"
+
+namespace {
+
+  /**
+   * @brief - Convenience structure regrouping the options of
+   *          the benchmarks.
+   */
+  struct Options {
+    std::string output;
+    int seed;
+    std::vector<unsigned> populations;
+    float budget;
+    std::string filter;
+    unsigned threads;
+  };
+
+  /**
+   * @brief - The result of a single benchmark for a given
+   *          population. Durations are expressed in nano
+   *          seconds.
+   */
+  struct Result {
+    std::string name;
+    unsigned population;
+    unsigned iterations;
+
+    double mean;
+    double min;
+    double p50;
+    double p99;
+  };
+
+  /**
+   * @brief - Layout of the walls of a synthetic map.
+   */
+  enum class Layout {
+    Open,
+    Scattered,
+    Maze
+  };
+
+  /**
+   * @brief - A synthetic set of elements along with a locator
+   *          allowing to query them. The locator keeps a ref
+   *          on the vectors so the scene should not be moved
+   *          once created.
+   */
+  struct Scene {
+    int w;
+    int h;
+
+    std::vector<new_frontiers::BlockShPtr> blocks;
+    std::vector<new_frontiers::EntityShPtr> entities;
+    std::vector<new_frontiers::VFXShPtr> vfxs;
+    std::vector<new_frontiers::ColonyShPtr> colonies;
+
+    new_frontiers::HandleTable<new_frontiers::Block> blockHandles;
+    new_frontiers::HandleTable<new_frontiers::Entity> entityHandles;
+    new_frontiers::HandleTable<new_frontiers::VFX> vfxHandles;
+
+    new_frontiers::Components components;
+
+    new_frontiers::LocatorShPtr loc;
+  };
+
+  using SceneShPtr = std::shared_ptr<Scene>;
+
+  /**
+   * @brief - The minimum number of iterations of a benchmark
+   *          whatever the time budget.
+   */
+  const unsigned sk_minIterations = 3u;
+
+  /**
+   * @brief - The maximum number of iterations of a benchmark.
+   */
+  const unsigned sk_maxIterations = 100000u;
+
+  /**
+   * @brief - The proportion of the population removed and
+   *          respawned at each iteration of the churn test.
+   */
+  const float sk_churn = 0.1f;
+
+  /**
+   * @brief - The number of steps between two checks of the order
+   *          of elements in the reordered step benchmark.
+   */
+  const unsigned sk_reorderInterval = 30u;
+
+  /**
+   * @brief - Parse a comma separated list of populations.
+   * @param str - the string to parse.
+   * @return - the list of populations.
+   */
+  std::vector<unsigned>
+  parsePopulations(const std::string& str) {
+    std::vector<unsigned> out;
+
+    std::size_t start = 0u;
+    while (start < str.size()) {
+      std::size_t end = str.find(',', start);
+      if (end == std::string::npos) {
+        end = str.size();
+      }
+
+      if (end > start) {
+        out.push_back(std::stoul(str.substr(start, end - start)));
+      }
+
+      start = end + 1u;
+    }
+
+    return out;
+  }
+
+  /**
+   * @brief - Parse the command line arguments into options.
+   *          Unknown arguments are ignored.
+   * @param argc - the number of arguments.
+   * @param argv - the arguments.
+   * @return - the parsed options.
+   */
+  Options
+  parseOptions(int argc, char** argv) {
+    Options o{"", 100, {1000u, 10000u, 100000u}, 0.5f, "", 1u};
+
+    for (int id = 1 ; id + 1 < argc ; id += 2) {
+      std::string key(argv[id]);
+      std::string val(argv[id + 1]);
+
+      if (key == "-o") {
+        o.output = val;
+      }
+      else if (key == "-s") {
+        o.seed = std::stoi(val);
+      }
+      else if (key == "-p") {
+        o.populations = parsePopulations(val);
+      }
+      else if (key == "-b") {
+        o.budget = std::stof(val);
+      }
+      else if (key == "-f") {
+        o.filter = val;
+      }
+      else if (key == "-j") {
+        o.threads = std::stoul(val);
+      }
+    }
+
+    return o;
+  }
+
+  /**
+   * @brief - Compute the dimensions of a square world able to
+   *          hold the input population with roughly a single
+   *          entity per cell.
+   * @param population - the number of entities.
+   * @return - the number of cells along each side.
+   */
+  int
+  sideFor(unsigned population) {
+    int s = 8;
+    while (1u * s * s < population) {
+      ++s;
+    }
+
+    return s;
+  }
+
+  /**
+   * @brief - Determine whether the cell at the input position
+   *          should be a wall in the specified layout.
+   * @param layout - the layout of the map.
+   * @param x - the abscissa of the cell.
+   * @param y - the ordinate of the cell.
+   * @param rng - used to scatter walls.
+   * @return - `true` if the cell is a wall.
+   */
+  bool
+  isWall(const Layout& layout, int x, int y, utils::RNG& rng) {
+    switch (layout) {
+      case Layout::Scattered:
+        return rng.rndFloat() < 0.1f;
+      case Layout::Maze:
+        // Horizontal walls every four rows with gaps every
+        // eight cells, shifted from a row to the next so
+        // that paths have to zigzag.
+        return y % 4 == 2 && (x + 4 * (y / 4)) % 8 != 0;
+      case Layout::Open:
+      default:
+        return false;
+    }
+  }
+
+  /**
+   * @brief - Create a new mob at the specified position.
+   * @param x - the abscissa of the mob.
+   * @param y - the ordinate of the mob.
+   * @param owner - the owner of the mob.
+   * @param warrior - `true` to create a warrior.
+   * @return - the created mob.
+   */
+  new_frontiers::EntityShPtr
+  newMob(float x, float y, new_frontiers::OwnerId owner, bool warrior) {
+    if (warrior) {
+      new_frontiers::Warrior::WProps pp = new_frontiers::EntityFactory::newWarriorProps(x, y, new_frontiers::tiles::MindlessGolem);
+      pp.homeX = x;
+      pp.homeY = y;
+      pp.owner = owner;
+
+      return std::make_shared<new_frontiers::Warrior>(pp);
+    }
+
+    new_frontiers::Worker::WProps pp = new_frontiers::EntityFactory::newWorkerProps(x, y, new_frontiers::tiles::CosmicThreat);
+    pp.homeX = x;
+    pp.homeY = y;
+    pp.owner = owner;
+
+    return std::make_shared<new_frontiers::Worker>(pp);
+  }
+
+  /**
+   * @brief - Create a new pheromon at the specified position.
+   * @param x - the abscissa of the pheromon.
+   * @param y - the ordinate of the pheromon.
+   * @param owner - the owner of the pheromon.
+   * @param rng - used to pick the type of the pheromon.
+   * @return - the created pheromon.
+   */
+  new_frontiers::VFXShPtr
+  newPheromon(float x, float y, new_frontiers::OwnerId owner, utils::RNG& rng) {
+    new_frontiers::pheromon::Type t = static_cast<new_frontiers::pheromon::Type>(rng.rndInt(0, 5));
+
+    new_frontiers::Pheromon::PProps pp = new_frontiers::PheromonFactory::newPheromonProps(x, y, t);
+    pp.owner = owner;
+
+    return new_frontiers::PheromonFactory::newPheromon(pp);
+  }
+
+  /**
+   * @brief - Generate a synthetic scene with the input number
+   *          of entities and as many pheromons.
+   * @param population - the number of entities.
+   * @param layout - the layout of the walls.
+   * @param mobs - `true` if entities and pheromons should be
+   *               created.
+   * @param rng - the random number generator to use.
+   * @return - the generated scene.
+   */
+  SceneShPtr
+  newScene(unsigned population, const Layout& layout, bool mobs, utils::RNG& rng) {
+    SceneShPtr s = std::make_shared<Scene>();
+
+    s->w = sideFor(population);
+    s->h = s->w;
+
+    s->colonies.push_back(std::make_shared<new_frontiers::Colony>(
+      new_frontiers::ColonyFactory::newColonyProps(1.0f, 1.0f, utils::Uuid::create())
+    ));
+    s->colonies.push_back(std::make_shared<new_frontiers::Colony>(
+      new_frontiers::ColonyFactory::newColonyProps(s->w - 2.0f, s->h - 2.0f, utils::Uuid::create())
+    ));
+
+    for (int y = 0 ; y < s->h ; ++y) {
+      for (int x = 0 ; x < s->w ; ++x) {
+        if (isWall(layout, x, y, rng)) {
+          s->blocks.push_back(
+            new_frontiers::BlockFactory::newBlock(new_frontiers::BlockFactory::newWallProps(x, y), "wall")
+          );
+        }
+      }
+    }
+
+    for (unsigned id = 0u ; mobs && id < population ; ++id) {
+      new_frontiers::OwnerId owner = s->colonies[id % 2u]->getOwner();
+
+      s->entities.push_back(newMob(rng.rndFloat(0.0f, s->w), rng.rndFloat(0.0f, s->h), owner, id % 4u == 0u));
+      s->vfxs.push_back(newPheromon(rng.rndFloat(0.0f, s->w), rng.rndFloat(0.0f, s->h), owner, rng));
+    }
+
+    for (unsigned id = 0u ; id < s->blocks.size() ; ++id) {
+      s->blockHandles.acquire(s->blocks[id]);
+    }
+    for (unsigned id = 0u ; id < s->entities.size() ; ++id) {
+      s->entityHandles.acquire(s->entities[id]);
+    }
+    for (unsigned id = 0u ; id < s->vfxs.size() ; ++id) {
+      s->vfxHandles.acquire(s->vfxs[id]);
+    }
+
+    s->loc = std::make_shared<new_frontiers::Locator>(
+      s->w, s->h,
+      s->blocks, s->entities, s->vfxs, s->colonies,
+      s->blockHandles, s->entityHandles, s->vfxHandles,
+      s->components
+    );
+
+    return s;
+  }
+
+  /**
+   * @brief - Pick a random position which is not obstructed
+   *          in the input scene.
+   * @param s - the scene.
+   * @param rng - the random number generator to use.
+   * @return - a free position.
+   */
+  utils::Point2f
+  freePosition(const Scene& s, utils::RNG& rng) {
+    utils::Point2f p;
+
+    do {
+      p.x() = std::floor(rng.rndFloat(0.0f, s.w)) + 0.5f;
+      p.y() = std::floor(rng.rndFloat(0.0f, s.h)) + 0.5f;
+    } while (s.loc->obstructed(p));
+
+    return p;
+  }
+
+  /**
+   * @brief - Pick a random free position within `d` cells of
+   *          the input position but not in the same cell.
+   * @param s - the scene.
+   * @param p - the reference position.
+   * @param d - the maximum distance to `p`.
+   * @param rng - the random number generator to use.
+   * @return - a free position close to `p`.
+   */
+  utils::Point2f
+  freePositionNear(const Scene& s, const utils::Point2f& p, float d, utils::RNG& rng) {
+    utils::Point2f e;
+
+    do {
+      e.x() = std::clamp(p.x() + rng.rndFloat(-d, d), 0.5f, s.w - 0.5f);
+      e.y() = std::clamp(p.y() + rng.rndFloat(-d, d), 0.5f, s.h - 0.5f);
+    } while (s.loc->obstructed(e) ||
+             (std::floor(e.x()) == std::floor(p.x()) && std::floor(e.y()) == std::floor(p.y())));
+
+    return e;
+  }
+
+  /**
+   * @brief - Run a benchmark until the time budget is spent
+   *          and compute statistics on the duration of each
+   *          iteration.
+   * @param name - the name of the benchmark.
+   * @param population - the population of the benchmark.
+   * @param budget - the time budget in seconds.
+   * @param run - the operation to measure.
+   * @param setup - an optional operation called before each
+   *                iteration and not accounted for.
+   * @return - the statistics for this benchmark.
+   */
+  Result
+  measure(const std::string& name,
+          unsigned population,
+          float budget,
+          std::function<void()> run,
+          std::function<void()> setup = nullptr)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<double> durations;
+    double spent = 0.0;
+
+    while (durations.size() < sk_minIterations ||
+           (spent < budget && durations.size() < sk_maxIterations))
+    {
+      if (setup) {
+        setup();
+      }
+
+      Clock::time_point s = Clock::now();
+      run();
+      Clock::time_point e = Clock::now();
+
+      durations.push_back(std::chrono::duration<double, std::nano>(e - s).count());
+      spent += std::chrono::duration<double>(e - s).count();
+    }
+
+    Result r{name, population, static_cast<unsigned>(durations.size()), 0.0, 0.0, 0.0, 0.0};
+
+    for (unsigned id = 0u ; id < durations.size() ; ++id) {
+      r.mean += durations[id];
+    }
+    r.mean /= durations.size();
+
+    std::sort(durations.begin(), durations.end());
+    r.min = durations.front();
+    r.p50 = durations[durations.size() / 2u];
+    r.p99 = durations[std::min(durations.size() - 1u, (99u * durations.size()) / 100u)];
+
+    std::cerr << std::fixed << std::setprecision(1)
+              << std::setw(40) << std::left << name << std::right
+              << std::setw(8) << population
+              << std::setw(10) << r.iterations << " it"
+              << std::setw(16) << r.mean << " ns" << std::endl;
+
+    return r;
+  }
+
+  /**
+   * @brief - Used to filter benchmarks based on their name.
+   */
+  class Suite {
+    public:
+
+      Suite(const Options& o):
+        m_options(o),
+        m_results()
+      {}
+
+      /**
+       * @brief - Whether the benchmark with this name should
+       *          be run.
+       * @param name - the name of the benchmark.
+       * @return - `true` if it should be run.
+       */
+      bool
+      enabled(const std::string& name) const noexcept {
+        return m_options.filter.empty() || name.find(m_options.filter) != std::string::npos;
+      }
+
+      /**
+       * @brief - Run the benchmark if it is enabled and keep
+       *          its result.
+       */
+      void
+      run(const std::string& name,
+          unsigned population,
+          std::function<void()> run,
+          std::function<void()> setup = nullptr)
+      {
+        if (enabled(name)) {
+          m_results.push_back(measure(name, population, m_options.budget, run, setup));
+        }
+      }
+
+      /**
+       * @brief - Dump the results as JSON in the input stream.
+       * @param out - the stream to write to.
+       */
+      void
+      dump(std::ostream& out) const {
+        out << std::fixed << std::setprecision(1)
+            << "{" << std::endl
+            << "  \"seed\": " << m_options.seed << "," << std::endl
+            << "  \"budget\": " << m_options.budget << "," << std::endl
+            << "  \"threads\": " << m_options.threads << "," << std::endl
+            << "  \"results\": [" << std::endl;
+
+        for (unsigned id = 0u ; id < m_results.size() ; ++id) {
+          const Result& r = m_results[id];
+
+          out << "    {"
+              << "\"name\": \"" << r.name << "\", "
+              << "\"population\": " << r.population << ", "
+              << "\"iterations\": " << r.iterations << ", "
+              << "\"mean_ns\": " << r.mean << ", "
+              << "\"min_ns\": " << r.min << ", "
+              << "\"p50_ns\": " << r.p50 << ", "
+              << "\"p99_ns\": " << r.p99
+              << "}" << (id + 1u < m_results.size() ? "," : "") << std::endl;
+        }
+
+        out << "  ]" << std::endl
+            << "}" << std::endl;
+      }
+
+    private:
+
+      const Options& m_options;
+      std::vector<Result> m_results;
+  };
+
+  /**
+   * @brief - Benchmarks of the locator and of the pheromon
+   *          analyzer which relies on it.
+   */
+  void
+  benchLocator(Suite& suite, unsigned population, utils::RNG& rng) {
+    SceneShPtr s = newScene(population, Layout::Scattered, true, rng);
+    const new_frontiers::Locator& loc = *s->loc;
+
+    new_frontiers::world::ItemType type = new_frontiers::world::ItemType::Entity;
+    new_frontiers::world::Filter f{s->colonies[0]->getOwner(), true};
+
+    float x = 0.0f, y = 0.0f;
+    utils::Point2f p, e;
+    std::pmr::vector<utils::Point2f> cPoints;
+    std::vector<new_frontiers::Pheromon*> pheromons;
+
+    auto pick = [&]() {
+      p = freePosition(*s, rng);
+      e = freePositionNear(*s, p, 8.0f, rng);
+      x = rng.rndFloat(0.0f, s->w - 16.0f);
+      y = rng.rndFloat(0.0f, s->h - 16.0f);
+    };
+
+    suite.run("locator.visible.rect", population,
+      [&]() { loc.getVisible(x, y, x + 16.0f, y + 16.0f); },
+      pick
+    );
+    suite.run("locator.visible.rect.filtered", population,
+      [&]() { loc.getVisible(x, y, x + 16.0f, y + 16.0f, &type, &f, new_frontiers::world::Sort::ZOrder); },
+      pick
+    );
+    suite.run("locator.visible.radius", population,
+      [&]() { loc.getVisible(p, 4.0f); },
+      pick
+    );
+    suite.run("locator.visible.radius.filtered", population,
+      [&]() { loc.getVisible(p, 4.0f, &type, &f, new_frontiers::world::Sort::Distance); },
+      pick
+    );
+    suite.run("locator.obstructed.point", population,
+      [&]() { loc.obstructed(e); },
+      pick
+    );
+    suite.run("locator.obstructed.segment", population,
+      [&]() { cPoints.clear(); loc.obstructed(p, e, cPoints); },
+      pick
+    );
+
+    // The analyzer is fed with the pheromons visible from a
+    // random position, as mobs do when wandering.
+    suite.run("pheromon_analyzer.compute_target", population,
+      [&]() {
+        new_frontiers::PheromonAnalyzer pa;
+        pa.setRandomWeight(0.2f);
+
+        for (unsigned id = 0u ; id < pheromons.size() ; ++id) {
+          pa.accumulate(*pheromons[id]);
+        }
+
+        float tx = e.x(), ty = e.y();
+        pa.computeTarget(tx, ty);
+      },
+      [&]() {
+        pick();
+
+        new_frontiers::tiles::Effect* te = nullptr;
+        std::pmr::vector<new_frontiers::VFXHandle> vfxs = loc.getVisible(p, 4.0f, te);
+
+        pheromons.clear();
+        for (unsigned id = 0u ; id < vfxs.size() ; ++id) {
+          new_frontiers::Pheromon* ph = dynamic_cast<new_frontiers::Pheromon*>(loc.resolve(vfxs[id]));
+          if (ph != nullptr) {
+            pheromons.push_back(ph);
+          }
+        }
+      }
+    );
+  }
+
+  /**
+   * @brief - Benchmarks of the path finding on open and maze
+   *          maps. The size of the map follows the population.
+   */
+  void
+  benchAStar(Suite& suite, unsigned population, utils::RNG& rng) {
+    const Layout layouts[] = {Layout::Open, Layout::Maze};
+    const std::string names[] = {"astar.open", "astar.maze"};
+
+    for (unsigned id = 0u ; id < 2u ; ++id) {
+      if (!suite.enabled(names[id])) {
+        continue;
+      }
+
+      SceneShPtr s = newScene(population, layouts[id], false, rng);
+
+      utils::Point2f p, e;
+      std::pmr::vector<utils::Point2f> path;
+
+      suite.run(names[id], population,
+        [&]() {
+          new_frontiers::AStar a(p, e, s->loc);
+          a.findPath(path, 20.0f);
+        },
+        [&]() {
+          p = freePosition(*s, rng);
+          e = freePositionNear(*s, p, 8.0f, rng);
+          path.clear();
+        }
+      );
+    }
+  }
+
+  /**
+   * @brief - Benchmarks of the world as a whole: full steps
+   *          and processing of influences with a large part
+   *          of the elements removed and respawned.
+   *          When the elements are reordered by location only
+   *          the steps are measured.
+   * @param reorder - the number of steps between two checks
+   *                  of the order of elements, `0` to never
+   *                  reorder them.
+   */
+  void
+  benchWorld(Suite& suite, unsigned population, unsigned threads, int seed, unsigned reorder, utils::RNG& rng) {
+    const std::string step = (reorder > 0u ? "world.step.reordered" : "world.step");
+    const bool churning = (reorder == 0u && suite.enabled("world.process_influences.churn"));
+
+    if (!churning && !suite.enabled(step)) {
+      return;
+    }
+
+    int side = sideFor(population);
+    new_frontiers::World w(seed, side, side);
+    w.setStepThreads(threads);
+    w.setReorderInterval(reorder);
+
+    new_frontiers::LocatorShPtr loc = w.locator();
+    new_frontiers::OwnerId owners[2] = {
+      loc->colony(0).id,
+      loc->colony(1 % loc->coloniesCount()).id
+    };
+
+    // Populate the world: keep track of the elements so that
+    // they can be removed afterwards.
+    std::vector<new_frontiers::EntityShPtr> entities;
+    std::vector<new_frontiers::VFXShPtr> vfxs;
+    std::vector<new_frontiers::Influence> batch;
+
+    for (unsigned id = 0u ; id < population / 50u ; ++id) {
+      new_frontiers::Deposit::DProps dp = new_frontiers::BlockFactory::newDepositProps(
+        std::floor(rng.rndFloat(0.0f, side)),
+        std::floor(rng.rndFloat(0.0f, side))
+      );
+      dp.stock = 100.0f;
+
+      batch.emplace_back(
+        new_frontiers::influence::Type::BlockSpawn,
+        new_frontiers::BlockFactory::newDeposit(dp)
+      );
+    }
+
+    auto spawn = [&](unsigned count) {
+      for (unsigned id = 0u ; id < count ; ++id) {
+        new_frontiers::OwnerId owner = owners[id % 2u];
+
+        entities.push_back(newMob(rng.rndFloat(0.0f, side), rng.rndFloat(0.0f, side), owner, id % 4u == 0u));
+        batch.emplace_back(new_frontiers::influence::Type::EntitySpawn, entities.back());
+
+        vfxs.push_back(newPheromon(rng.rndFloat(0.0f, side), rng.rndFloat(0.0f, side), owner, rng));
+        batch.emplace_back(new_frontiers::influence::Type::VFXSpawn, vfxs.back());
+      }
+    };
+
+    spawn(population);
+    w.apply(batch);
+    batch.clear();
+
+    new_frontiers::controls::State controls = new_frontiers::controls::newState();
+
+    suite.run(step, population,
+      [&]() { w.step(1.0f / 60.0f, controls); }
+    );
+
+    if (!churning) {
+      return;
+    }
+
+    // Remove a random subset of the elements and spawn as
+    // many new ones.
+    unsigned churn = std::max(1u, static_cast<unsigned>(sk_churn * population));
+
+    suite.run("world.process_influences.churn", population,
+      [&]() { w.apply(batch); },
+      [&]() {
+        batch.clear();
+
+        for (unsigned id = 0u ; id < churn && !entities.empty() ; ++id) {
+          unsigned e = rng.rndInt(0, entities.size() - 1u);
+          batch.emplace_back(new_frontiers::influence::Type::EntityRemoval, entities[e]->getHandle());
+          std::swap(entities[e], entities.back());
+          entities.pop_back();
+
+          unsigned v = rng.rndInt(0, vfxs.size() - 1u);
+          batch.emplace_back(new_frontiers::influence::Type::VFXRemoval, vfxs[v]->getHandle());
+          std::swap(vfxs[v], vfxs.back());
+          vfxs.pop_back();
+        }
+
+        spawn(churn);
+      }
+    );
+  }
+
+}
+
+int main(int argc, char** argv) {
+  // Create the logger: we only want to see important
+  // messages as the simulation is quite verbose.
+  utils::log::StdLogger raw;
+  raw.setLevel(utils::log::Severity::WARNING);
+  new_frontiers::logging::setLevel(new_frontiers::logging::Level::Warning);
+  utils::log::PrefixedLogger logger("bench", "main");
+  utils::log::Locator::provide(&raw);
+
+  try {
+    Options o = parseOptions(argc, argv);
+    Suite suite(o);
+
+    for (unsigned id = 0u ; id < o.populations.size() ; ++id) {
+      utils::RNG rng(o.seed);
+
+      benchLocator(suite, o.populations[id], rng);
+      benchAStar(suite, o.populations[id], rng);
+
+      // Both variants of the world benchmarks start from the
+      // same world so that their steps can be compared.
+      utils::RNG plain(o.seed);
+      benchWorld(suite, o.populations[id], o.threads, o.seed, 0u, plain);
+
+      utils::RNG reordered(o.seed);
+      benchWorld(suite, o.populations[id], o.threads, o.seed, sk_reorderInterval, reordered);
+    }
+
+    if (o.output.empty()) {
+      suite.dump(std::cout);
+    }
+    else {
+      std::ofstream out(o.output.c_str());
+      if (!out.good()) {
+        logger.error("Unable to write benchmarks results to \"" + o.output + "\"");
+        return EXIT_FAILURE;
+      }
+
+      suite.dump(out);
+    }
+  }
+  catch (const utils::CoreException& e) {
+    logger.error("Caught internal exception while running benchmarks", e.what());
+    return EXIT_FAILURE;
+  }
+  catch (const std::exception& e) {
+    logger.error("Caught internal exception while running benchmarks", e.what());
+    return EXIT_FAILURE;
+  }
+  catch (...) {
+    logger.error("Unexpected error while running benchmarks");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
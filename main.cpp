@@ -37,20 +37,28 @@
  */
 // TODO: Quadtree system to represent the elements of the world (in Locator class).
 
+# include <iostream>
 # include <core_utils/log/StdLogger.hh>
 # include <core_utils/log/Locator.hh>
 # include <core_utils/log/PrefixedLogger.hh>
 # include <core_utils/CoreException.hh>
 # include "app/IsometricApp.hh"
 # include "app/TopViewApp.hh"
+# include "LogSink.hh"
 
 int main(int /*argc*/, char** /*argv*/) {
   // Create the logger.
   utils::log::StdLogger raw;
   raw.setLevel(utils::log::Severity::DEBUG);
+  new_frontiers::logging::setLevel(new_frontiers::logging::Level::Debug);
   utils::log::PrefixedLogger logger("pge", "main");
   utils::log::Locator::provide(&raw);
 
+  // The debug messages of the simulation are written from
+  // a background thread so that they don't block frames.
+  new_frontiers::logging::AsyncSink sink(std::cout);
+  new_frontiers::logging::install(&sink);
+
   try {
     logger.notice("Starting application");
 
@@ -90,6 +98,8 @@ int main(int /*argc*/, char** /*argv*/) {
     logger.error("Unexpected error while setting up application");
   }
 
+  new_frontiers::logging::install(nullptr);
+
   // All is good.
   return EXIT_SUCCESS;
 }
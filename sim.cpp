@@ -0,0 +1,402 @@
+
+/**
+ * @brief - Headless runner for the simulation. It creates a
+ *          world (either generated or loaded from a level
+ *          file) and steps it as fast as possible for a given
+ *          number of ticks with a fixed time step. Statistics
+ *          about the duration of ticks are then printed.
+ *
+ *          This executable does not depend on any rendering
+ *          library so that it can be used to measure how the
+ *          simulation scales on machines without a display.
+ *          The time spent in each phase of a tick can also be
+ *          exported to a CSV file, and the zones executed during
+ *          the run captured as a trace (when compiled in).
+ *
+ *          Usage:
+ *            new_frontiers_sim [-t ticks] [-l level] [-s seed]
+ *                              [-w width] [-h height] [-j threads]
+ *                              [-e 0|1] [-c profile.csv] [-x trace.json]
+ *                              [-z 0|1] [-r steps]
+ *          where `-e 1` enables the component storage of effects and entities
+ *          and `-r` the reordering of entities and effects by
+ *          location, checked every `steps` steps.
+ *          A digest of the final state of the world is printed:
+ *          runs with the same options but a different number of
+ *          threads should report the same value.
+ *          The heap allocations performed by steady ticks during
+ *          the second half of the run are counted: `-z 1` makes
+ *          the runner fail if any of them allocated memory. A tick
+ *          is not steady when it creates entities (their paths are
+ *          allocated), changes the blocks, brings the population of
+ *          entities and effects above its previous peak (lists grow
+ *          to the new size) or grows the buffers the world reuses
+ *          from one step to the next. These ticks are reported
+ *          apart.
+ */
+
+# include <new>
+# include <atomic>
+# include <chrono>
+# include <vector>
+# include <cstdlib>
+# include <string>
+# include <iomanip>
+# include <iostream>
+# include <algorithm>
+# include <core_utils/log/StdLogger.hh>
+# include <core_utils/log/Locator.hh>
+# include <core_utils/log/PrefixedLogger.hh>
+# include <core_utils/CoreException.hh>
+# include "World.hh"
+# include "Trace.hh"
+# include "Pool.hh"
+# include "Logging.hh"
+# include "blocks/Deposit.hh"
+# include "blocks/SpawnerOMeter.hh"
+# include "entities/Worker.hh"
+# include "entities/Warrior.hh"
+# include "effects/Pheromon.hh"
+
+namespace {
+
+  /**
+   * @brief - The number of heap allocations performed since the
+   *          start of the program, from any thread.
+   */
+  std::atomic_size_t allocations(0u);
+
+  /**
+   * @brief - Allocate memory from the heap and count it. The
+   *          replaceable allocation functions below forward to
+   *          this method.
+   * @param size - the number of bytes to allocate.
+   * @param align - the alignment of the memory.
+   * @return - the allocated memory.
+   */
+  void*
+  allocate(std::size_t size, std::size_t align) {
+    allocations.fetch_add(1u, std::memory_order_relaxed);
+
+    void* p = nullptr;
+    if (align <= alignof(std::max_align_t)) {
+      p = std::malloc(size == 0u ? 1u : size);
+    }
+    else {
+      p = std::aligned_alloc(align, ((std::max(size, std::size_t(1u)) + align - 1u) / align) * align);
+    }
+
+    if (p == nullptr) {
+      throw std::bad_alloc();
+    }
+
+    return p;
+  }
+
+  /**
+   * @brief - The number of entities created since the start of
+   *          the program, as counted by the pools they are drawn
+   *          from.
+   * @return - the number of entities created so far.
+   */
+  std::size_t
+  entitiesCreated() {
+    std::vector<new_frontiers::SlabPool::Stats> pools = new_frontiers::pool::stats();
+
+    std::size_t count = 0u;
+    for (unsigned id = 0u ; id < pools.size() ; ++id) {
+      if (pools[id].name == "workers" || pools[id].name == "warriors" || pools[id].name == "players") {
+        count += pools[id].allocations;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief - Convenience structure regrouping the options of
+   *          the simulation.
+   */
+  struct Options {
+    unsigned ticks;
+    std::string level;
+    int seed;
+    int width;
+    int height;
+    unsigned threads;
+    bool components;
+    float dt;
+    std::string csv;
+    std::string trace;
+    bool zero;
+    unsigned reorder;
+  };
+
+  /**
+   * @brief - Parse the command line arguments into options.
+   *          Unknown arguments are ignored.
+   * @param argc - the number of arguments.
+   * @param argv - the arguments.
+   * @return - the parsed options.
+   */
+  Options
+  parseOptions(int argc, char** argv) {
+    Options o{10000u, "", 100, 15, 15, 1u, false, 1.0f / 60.0f, "", "", false, 0u};
+
+    for (int id = 1 ; id + 1 < argc ; id += 2) {
+      std::string key(argv[id]);
+      std::string val(argv[id + 1]);
+
+      if (key == "-t") {
+        o.ticks = std::stoul(val);
+      }
+      else if (key == "-l") {
+        o.level = val;
+      }
+      else if (key == "-s") {
+        o.seed = std::stoi(val);
+      }
+      else if (key == "-w") {
+        o.width = std::stoi(val);
+      }
+      else if (key == "-h") {
+        o.height = std::stoi(val);
+      }
+      else if (key == "-j") {
+        o.threads = std::stoul(val);
+      }
+      else if (key == "-e") {
+        o.components = (std::stoi(val) != 0);
+      }
+      else if (key == "-c") {
+        o.csv = val;
+      }
+      else if (key == "-x") {
+        o.trace = val;
+      }
+      else if (key == "-z") {
+        o.zero = (std::stoi(val) != 0);
+      }
+      else if (key == "-r") {
+        o.reorder = std::stoul(val);
+      }
+    }
+
+    return o;
+  }
+
+}
+
+void*
+operator new(std::size_t size) {
+  return allocate(size, alignof(std::max_align_t));
+}
+
+void*
+operator new(std::size_t size, std::align_val_t align) {
+  return allocate(size, static_cast<std::size_t>(align));
+}
+
+void
+operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+int main(int argc, char** argv) {
+  // Create the logger: we only want to see important
+  // messages as the simulation is quite verbose.
+  utils::log::StdLogger raw;
+  raw.setLevel(utils::log::Severity::WARNING);
+  new_frontiers::logging::setLevel(new_frontiers::logging::Level::Warning);
+  utils::log::PrefixedLogger logger("sim", "main");
+  utils::log::Locator::provide(&raw);
+
+  try {
+    Options o = parseOptions(argc, argv);
+
+    new_frontiers::WorldShPtr w = nullptr;
+    if (o.level.empty()) {
+      w = std::make_shared<new_frontiers::World>(o.seed, o.width, o.height);
+    }
+    else {
+      w = std::make_shared<new_frontiers::World>(o.seed, o.level);
+    }
+
+    w->setStepThreads(o.threads);
+    w->setComponentStorage(o.components);
+    w->setReorderInterval(o.reorder);
+    if (!o.csv.empty()) {
+      w->profiler()->dump(o.csv);
+    }
+    if (!o.trace.empty()) {
+      new_frontiers::trace::Tracer::instance().start(o.trace);
+    }
+
+    new_frontiers::controls::State controls = new_frontiers::controls::newState();
+
+    // Step the world and record the duration of each
+    // tick.
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> durations(o.ticks, 0.0);
+
+    // Allocations are only counted over the second half of
+    // the run, where the simulation is expected to be steady.
+    // Ticks growing the world are counted apart.
+    const unsigned warmup = o.ticks / 2u;
+    std::size_t allocated = 0u;
+    unsigned allocating = 0u;
+    std::size_t grown = 0u;
+    unsigned growing = 0u;
+
+    new_frontiers::LocatorShPtr loc = w->locator();
+    std::size_t created = entitiesCreated();
+    int peak = loc->entitiesCount() + loc->vfxsCount();
+    int blocks = loc->blocksCount();
+    std::size_t buffers = w->buffersCapacity();
+
+    Clock::time_point start = Clock::now();
+
+    for (unsigned id = 0u ; id < o.ticks ; ++id) {
+      std::size_t before = allocations.load(std::memory_order_relaxed);
+
+      Clock::time_point s = Clock::now();
+      w->step(o.dt, controls);
+      durations[id] = std::chrono::duration<double, std::milli>(Clock::now() - s).count();
+
+      std::size_t count = allocations.load(std::memory_order_relaxed) - before;
+
+      std::size_t c = entitiesCreated();
+      int population = loc->entitiesCount() + loc->vfxsCount();
+      int b = loc->blocksCount();
+      std::size_t bc = w->buffersCapacity();
+      bool steady = (c == created && b == blocks && population <= peak && bc == buffers);
+
+      created = c;
+      blocks = b;
+      peak = std::max(peak, population);
+      buffers = bc;
+
+      if (id >= warmup && count > 0u) {
+        if (steady) {
+          allocated += count;
+          ++allocating;
+        }
+        else {
+          grown += count;
+          ++growing;
+        }
+      }
+    }
+
+    double total = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Compute statistics.
+    double mean = 0.0;
+    for (unsigned id = 0u ; id < durations.size() ; ++id) {
+      mean += durations[id];
+    }
+    mean /= std::max<std::size_t>(durations.size(), 1u);
+
+    double p99 = 0.0;
+    if (!durations.empty()) {
+      std::size_t rank = (99u * durations.size()) / 100u;
+      rank = std::min(rank, durations.size() - 1u);
+
+      std::nth_element(durations.begin(), durations.begin() + rank, durations.end());
+      p99 = durations[rank];
+    }
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "ticks:     " << o.ticks << " (dt: " << o.dt << "s, threads: " << o.threads << ")" << std::endl
+              << "duration:  " << total << "s" << std::endl
+              << "ticks/s:   " << (total > 0.0 ? o.ticks / total : 0.0) << std::endl
+              << "mean tick: " << mean << "ms" << std::endl
+              << "p99 tick:  " << p99 << "ms" << std::endl
+              << "entities:  " << loc->entitiesCount() << std::endl
+              << "vfxs:      " << loc->vfxsCount() << std::endl
+              << "allocs:    " << allocated << " in " << allocating << "/" << (o.ticks - warmup)
+              << " steady tick(s), " << grown << " in " << growing << " growing tick(s)" << std::endl
+              << "digest:    " << std::hex << std::setw(16) << std::setfill('0') << w->digest()
+              << std::dec << std::setfill(' ') << std::endl;
+
+    // Time spent in each phase over the last ticks.
+    std::vector<new_frontiers::Profiler::Stats> phases = w->profiler()->stats();
+
+    std::cout << "phases:    p50/p95/p99 (ms)" << std::endl;
+    for (unsigned id = 0u ; id < phases.size() ; ++id) {
+      std::cout << "  " << std::left << std::setw(11) << phases[id].name << std::right
+                << phases[id].p50 << "/" << phases[id].p95 << "/" << phases[id].p99
+                << std::endl;
+    }
+
+    // Occupancy of the pools used to allocate elements.
+    std::vector<new_frontiers::SlabPool::Stats> pools = new_frontiers::pool::stats();
+
+    std::cout << "pools:     used/high/capacity (block, allocations)" << std::endl;
+    for (unsigned id = 0u ; id < pools.size() ; ++id) {
+      std::cout << "  " << std::left << std::setw(11) << pools[id].name << std::right
+                << pools[id].used << "/" << pools[id].highWater << "/" << pools[id].capacity
+                << " (" << pools[id].block << "B, " << pools[id].allocations << ")"
+                << std::endl;
+    }
+
+    // Footprint of the elements: each one of them is also
+    // counted in the block of its pool if any.
+    std::vector<std::pair<std::string, std::size_t>> sizes = {
+      {"deposit", sizeof(new_frontiers::Deposit)},
+      {"spawner", sizeof(new_frontiers::SpawnerOMeter)},
+      {"worker", sizeof(new_frontiers::Worker)},
+      {"warrior", sizeof(new_frontiers::Warrior)},
+      {"pheromon", sizeof(new_frontiers::Pheromon)},
+      {"colony", sizeof(new_frontiers::Colony)},
+      {"influence", sizeof(new_frontiers::Influence)}
+    };
+
+    std::cout << "memory:    bytes per element" << std::endl;
+    for (unsigned id = 0u ; id < sizes.size() ; ++id) {
+      std::cout << "  " << std::left << std::setw(11) << sizes[id].first << std::right
+                << sizes[id].second << std::endl;
+    }
+
+    // Flush the profiling data if needed.
+    w->profiler()->dump("");
+    new_frontiers::trace::Tracer::instance().stop();
+
+    if (o.zero && allocated > 0u) {
+      logger.error(
+        "Steady-state ticks allocated memory",
+        std::to_string(allocated) + " allocation(s) in " + std::to_string(allocating) + " tick(s)"
+      );
+      return EXIT_FAILURE;
+    }
+  }
+  catch (const utils::CoreException& e) {
+    logger.error("Caught internal exception while running simulation", e.what());
+    return EXIT_FAILURE;
+  }
+  catch (const std::exception& e) {
+    logger.error("Caught internal exception while running simulation", e.what());
+    return EXIT_FAILURE;
+  }
+  catch (...) {
+    logger.error("Unexpected error while running simulation");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
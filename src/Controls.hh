@@ -77,6 +77,16 @@ namespace new_frontiers {
     State
     newState() noexcept;
 
+    /**
+     * @brief - Compare two controls structures.
+     * @param lhs - the first structure.
+     * @param rhs - the second structure.
+     * @return - `true` if both structures describe the same
+     *           state of the controls.
+     */
+    bool
+    operator==(const State& lhs, const State& rhs) noexcept;
+
   }
 }
 
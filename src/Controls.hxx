@@ -22,6 +22,18 @@ namespace new_frontiers {
       return c;
     }
 
+    inline
+    bool
+    operator==(const State& lhs, const State& rhs) noexcept {
+      return
+        lhs.mPosX == rhs.mPosX &&
+        lhs.mPosY == rhs.mPosY &&
+        lhs.keys == rhs.keys &&
+        lhs.buttons == rhs.buttons &&
+        lhs.tab == rhs.tab
+      ;
+    }
+
   }
 }
 
@@ -1,7 +1,11 @@
 
 # include "PGEApp.hh"
+# include <thread>
+# include <iomanip>
+# include <sstream>
 # include "utils.hh"
 # include "Controls.hh"
+# include "Pool.hh"
 
 namespace new_frontiers {
 
@@ -11,12 +15,13 @@ namespace new_frontiers {
 
     m_menu(nullptr),
 
-    m_world(nullptr),
-    m_loc(nullptr),
+    m_sim(nullptr),
 
     m_cf(desc.frame),
 
     m_controls(controls::newState()),
+    m_postedControls(m_controls),
+    m_postedViewport(),
 
     m_mLayer(0u),
     m_dLayer(0u),
@@ -26,7 +31,17 @@ namespace new_frontiers {
     m_uiOn(true),
 
     m_state(State::Running),
-    m_first(true)
+    m_speed(1u),
+
+    m_first(true),
+
+    m_profiler(
+      std::make_shared<Profiler>(
+        "render",
+        std::vector<std::string>{"draw", "ui", "debug", "engine"}
+      )
+    ),
+    m_frameEnd()
   {
     // Initialize the application settings.
     sAppName = desc.name;
@@ -49,11 +64,21 @@ namespace new_frontiers {
     // Create the world.
 // # define WORLD_FROM_FILE
 # ifdef WORLD_FROM_FILE
-    m_world = std::make_shared<World>(100, std::string("data/worlds/level_1.lvl"));
+    WorldShPtr world = std::make_shared<World>(100, std::string("data/worlds/level_1.lvl"));
 # else
-    m_world = std::make_shared<World>(100, 15, 15);
+    WorldShPtr world = std::make_shared<World>(100, 15, 15);
 # endif
-    m_loc = m_world->locator();
+
+    // Step entities using all the available cores: this
+    // does not change the result of the simulation.
+    world->setStepThreads(std::thread::hardware_concurrency());
+
+    // Start the simulation: from now on the world is only
+    // accessed through the simulation, which owns it. The
+    // app does not keep it so that the render thread can
+    // not reach it by mistake.
+    m_sim = std::make_shared<Simulation>(world);
+    m_sim->start();
 
     // Load the menu resources.
     loadMenuResources();
@@ -174,6 +199,28 @@ namespace new_frontiers {
       m_uiOn = !m_uiOn;
     }
 
+    // Change the speed of the simulation: we only
+    // allow powers of two so that it is easy to go
+    // back to normal speed.
+    if (GetKey(olc::NP_ADD).bReleased && m_speed < MAX_SPEED) {
+      m_speed *= 2u;
+      m_sim->setSpeed(m_speed);
+      info("Simulation speed set to x" + std::to_string(m_speed));
+    }
+    if (GetKey(olc::NP_SUB).bReleased && m_speed > 1u) {
+      m_speed /= 2u;
+      m_sim->setSpeed(m_speed);
+      info("Simulation speed set to x" + std::to_string(m_speed));
+    }
+
+    if (GetKey(olc::R).bReleased) {
+      toggleProfileExport();
+    }
+
+    if (GetKey(olc::T).bReleased) {
+      toggleTrace();
+    }
+
     if (GetKey(olc::P).bReleased) {
       switch (m_state) {
         case State::Running:
@@ -192,4 +239,83 @@ namespace new_frontiers {
     return ic;
   }
 
+  void
+  PGEApp::drawProfile() {
+    std::vector<Profiler::Stats> sim = m_sim->profiler()->stats();
+    std::vector<Profiler::Stats> render = m_profiler->stats();
+
+    auto line = [](const Profiler::Stats& s) {
+      std::ostringstream out;
+      out << std::fixed << std::setprecision(2)
+          << std::left << std::setw(11) << s.name
+          << std::right << std::setw(7) << s.p50
+          << std::setw(7) << s.p95
+          << std::setw(7) << s.p99;
+
+      return out.str();
+    };
+
+    int dOffset = 10;
+    int y = 0;
+
+    DrawString(olc::vi2d(0, y), "tick (ms)      p50    p95    p99", olc::YELLOW);
+    for (unsigned id = 0u ; id < sim.size() ; ++id) {
+      y += dOffset;
+      DrawString(olc::vi2d(0, y), line(sim[id]), olc::CYAN);
+    }
+
+    y += 2 * dOffset;
+    DrawString(olc::vi2d(0, y), "frame (ms)     p50    p95    p99", olc::YELLOW);
+    for (unsigned id = 0u ; id < render.size() ; ++id) {
+      y += dOffset;
+      DrawString(olc::vi2d(0, y), line(render[id]), olc::CYAN);
+    }
+
+    std::vector<SlabPool::Stats> pools = pool::stats();
+
+    y += 2 * dOffset;
+    DrawString(olc::vi2d(0, y), "pool          used   high    cap", olc::YELLOW);
+    for (unsigned id = 0u ; id < pools.size() ; ++id) {
+      std::ostringstream out;
+      out << std::left << std::setw(11) << pools[id].name
+          << std::right << std::setw(7) << pools[id].used
+          << std::setw(7) << pools[id].highWater
+          << std::setw(7) << pools[id].capacity;
+
+      y += dOffset;
+      DrawString(olc::vi2d(0, y), out.str(), olc::CYAN);
+    }
+
+    if (m_profiler->dumping()) {
+      y += 2 * dOffset;
+      DrawString(olc::vi2d(0, y), "Exporting profile to CSV", olc::RED);
+    }
+  }
+
+  void
+  PGEApp::toggleProfileExport() {
+    if (m_profiler->dumping()) {
+      m_sim->profiler()->dump("");
+      m_profiler->dump("");
+
+      info("Stopped exporting profiling data");
+      return;
+    }
+
+    m_sim->profiler()->dump("profile_ticks.csv");
+    m_profiler->dump("profile_frames.csv");
+  }
+
+  void
+  PGEApp::toggleTrace() {
+    trace::Tracer& t = trace::Tracer::instance();
+
+    if (t.active()) {
+      t.stop();
+      return;
+    }
+
+    t.start("trace.json");
+  }
+
 }
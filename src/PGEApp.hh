@@ -1,10 +1,14 @@
 #ifndef    PGE_APP_HH
 # define   PGE_APP_HH
 
+# include <chrono>
 # include <core_utils/CoreObject.hh>
 # include "olcPixelGameEngine.h"
 # include "World.hh"
-# include "Locator.hh"
+# include "Simulation.hh"
+# include "RenderState.hh"
+# include "Profiler.hh"
+# include "Trace.hh"
 # include "Controls.hh"
 # include "AppDesc.hh"
 # include "coordinates/CoordinateFrame.hh"
@@ -15,12 +19,12 @@ namespace new_frontiers {
   /**
    * @brief - Convenience structure defining the resources
    *          that can be displayed in any app. It contains
-   *          pointers to the world's data, to the frames
+   *          a snapshot of the world's data, the frames
    *          allowing to change from screen coordinates to
    *          world coordinates and the UI.
    */
   struct RenderDesc {
-    LocatorShPtr loc;
+    const RenderState& state;
     CoordinateFrame& cf;
     GameMenuShPtr ui;
   };
@@ -241,6 +245,26 @@ namespace new_frontiers {
         bool debugLayerToggled;
       };
 
+      /**
+       * @brief - The stages of a frame measured by the profiler.
+       *          The `Engine` stage covers the time spent by the
+       *          engine between two updates: it composites the
+       *          layers and presents the frame.
+       */
+      enum Stage {
+        Draw,
+        DrawUI,
+        DrawDebug,
+        Engine
+      };
+
+      /**
+       * @brief - The maximum speed multiplier for the simulation.
+       *          The speed can be set to any power of two up to
+       *          this value.
+       */
+      static constexpr unsigned MAX_SPEED = 64u;
+
       /**
        * @brief - Performs the initialization of the engine to make
        *          it suits our needs.
@@ -272,6 +296,30 @@ namespace new_frontiers {
       InputChanges
       handleInputs();
 
+      /**
+       * @brief - Draw a panel with the time spent in each phase
+       *          of the simulation and each stage of rendering in
+       *          the debug layer.
+       */
+      void
+      drawProfile();
+
+      /**
+       * @brief - Start or stop the export of the profiling data
+       *          of the simulation and of rendering to CSV files.
+       */
+      void
+      toggleProfileExport();
+
+      /**
+       * @brief - Start or stop the capture of a trace of the zones
+       *          executed by the simulation and the rendering. The
+       *          trace is saved in `trace.json` when the capture is
+       *          stopped.
+       */
+      void
+      toggleTrace();
+
     private:
 
       /**
@@ -283,19 +331,12 @@ namespace new_frontiers {
       GameMenuShPtr m_menu;
 
       /**
-       * @brief - The world managed by this application.
+       * @brief - The simulation stepping the world on a dedicated
+       *          thread. Once it is started the world should only
+       *          be modified through commands posted to it and is
+       *          rendered through the states it publishes.
        */
-      WorldShPtr m_world;
-
-      /**
-       * @brief - An element to use to interact with elements from
-       *          the world. This object provide convenience methods
-       *          to access in an efficient way elements that are
-       *          within a particular region or in a way that allow
-       *          efficient drawing on screen (such as in ascending
-       *          `z` order).
-       */
-      LocatorShPtr m_loc;
+      SimulationShPtr m_sim;
 
       /**
        * @brief - Holds an object allowing to convert between the
@@ -312,6 +353,18 @@ namespace new_frontiers {
        */
       controls::State m_controls;
 
+      /**
+       * @brief - The last controls forwarded to the simulation:
+       *          they are only posted again when they change.
+       */
+      controls::State m_postedControls;
+
+      /**
+       * @brief - The last area displayed on screen forwarded to
+       *          the simulation. Similar to `m_postedControls`.
+       */
+      Viewport m_postedViewport;
+
       /**
        * @brief - The index representing the main layer for this
        *          app. Given how the pixel game engine is designed
@@ -359,12 +412,32 @@ namespace new_frontiers {
        */
       State m_state;
 
+      /**
+       * @brief - The current speed multiplier of the simulation: a
+       *          value of `2` means that two seconds of simulated
+       *          time elapse for each second of real time.
+       */
+      unsigned m_speed;
+
       /**
        * @brief - Boolean allowing to display logs only on the
        *          first frame. Or do any other process a single
        *          time upon rendering the first frame.
        */
       bool m_first;
+
+      /**
+       * @brief - Measures the time spent in each stage of the
+       *          rendering of a frame.
+       */
+      ProfilerShPtr m_profiler;
+
+      /**
+       * @brief - The moment at which the last update ended. It is
+       *          used to measure the time spent by the engine until
+       *          the next update.
+       */
+      std::chrono::steady_clock::time_point m_frameEnd;
   };
 
 }
@@ -8,35 +8,64 @@ namespace new_frontiers {
 
   inline
   bool
-  PGEApp::OnUserUpdate(float fElapsedTime) {
+  PGEApp::OnUserUpdate(float /*fElapsedTime*/) {
+    // The time elapsed since the end of the last update
+    // was spent by the engine to present the frame.
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (!isFirstFrame()) {
+      m_profiler->record(Engine, start - m_frameEnd);
+    }
+
     // Handle inputs.
     InputChanges ic = handleInputs();
 
-    // Handle game logic if needed.
+    // Forward the controls to the simulation which
+    // steps the world on its own thread: entities
+    // (such as the player) rely on them. Commands
+    // are only posted when something changed so
+    // that a still frame does not cost anything.
+    if (isFirstFrame() || !(m_controls == m_postedControls)) {
+      m_sim->setControls(m_controls);
+      m_postedControls = m_controls;
+    }
+
+    // Also forward the area displayed on screen: visible
+    // entities are updated more often.
+    Viewport v = m_cf->cellsViewport();
+    if (isFirstFrame() || v.p != m_postedViewport.p || v.dims != m_postedViewport.dims) {
+      m_sim->setViewport(v.p.x, v.p.y, v.p.x + v.dims.x, v.p.y + v.dims.y);
+      m_postedViewport = v;
+    }
+
+    // Handle game state transitions if needed.
     switch (m_state) {
-      case State::Running:
-        m_world->step(fElapsedTime, m_controls);
-        break;
       case State::Pausing:
-        m_world->pause(fElapsedTime, m_controls);
+        m_sim->pause();
         m_state = State::Paused;
         break;
       case State::Resuming:
-        m_world->resume(fElapsedTime, m_controls);
+        m_sim->resume();
         m_state = State::Running;
         break;
+      case State::Running:
       case State::Paused:
       default:
         break;
     }
 
     // Handle menus update and process the
-    // corresponding actions.
+    // corresponding actions: they are applied
+    // by the simulation thread.
     std::vector<ActionShPtr> actions;
     Menu::InputHandle ih = m_menu->processUserInput(m_controls, actions);
 
     for (unsigned id = 0u ; id < actions.size() ; ++id) {
-      actions[id]->apply(*m_world);
+      ActionShPtr a = actions[id];
+      m_sim->post(
+        [a](World& w) {
+          a->apply(w);
+        }
+      );
     }
 
     // Detect clicks with the left mouse button to be
@@ -47,11 +76,22 @@ namespace new_frontiers {
     {
       olc::vf2d it;
       olc::vi2d tp = m_cf->pixelCoordsToTiles(olc::vi2d(m_controls.mPosX, m_controls.mPosY), &it);
-      m_world->performAction(tp.x + it.x, tp.y + it.y);
+      float x = tp.x + it.x;
+      float y = tp.y + it.y;
+
+      m_sim->post(
+        [x, y](World& w) {
+          w.performAction(x, y);
+        }
+      );
     }
 
     if (m_controls.tab) {
-      m_world->switchToNextOwner();
+      m_sim->post(
+        [](World& w) {
+          w.switchToNextOwner();
+        }
+      );
     }
 
     // Handle rendering: for each function
@@ -63,16 +103,23 @@ namespace new_frontiers {
     olc::Sprite* base = GetDrawTarget();
 
     RenderDesc res{
-      m_loc, // Locator
-      *m_cf, // Coordinate frame
-      m_menu // Game menu
+      m_sim->acquire(), // Render state
+      *m_cf,            // Coordinate frame
+      m_menu            // Game menu
     };
 
     SetDrawTarget(m_mLayer);
-    draw(res);
+    {
+      ScopedTimer t(*m_profiler, Draw);
+      TRACE_ZONE("app::draw");
+      draw(res);
+    }
 
     if (hasUI()) {
       SetDrawTarget(m_uiLayer);
+
+      ScopedTimer t(*m_profiler, DrawUI);
+      TRACE_ZONE("app::drawUI");
       drawUI(res);
     }
     if (!hasUI() && isFirstFrame()) {
@@ -94,7 +141,13 @@ namespace new_frontiers {
     // updated.
     if (hasDebug()) {
       SetDrawTarget(m_dLayer);
-      drawDebug(res);
+      {
+        ScopedTimer t(*m_profiler, DrawDebug);
+        TRACE_ZONE("app::drawDebug");
+        drawDebug(res);
+      }
+
+      drawProfile();
     }
     if (!hasDebug() && (ic.debugLayerToggled || isFirstFrame())) {
       SetDrawTarget(m_dLayer);
@@ -107,12 +160,20 @@ namespace new_frontiers {
     // Not the first frame anymore.
     m_first = false;
 
+    m_profiler->tick();
+    m_frameEnd = std::chrono::steady_clock::now();
+
     return !ic.quit;
   }
 
   inline
   bool
   PGEApp::OnUserDestroy() {
+    // Stop the simulation.
+    if (m_sim != nullptr) {
+      m_sim->stop();
+    }
+
     // Clear menu resources.
     if (m_menu != nullptr) {
       m_menu.reset();
@@ -1,6 +1,8 @@
 
 # include "IsometricApp.hh"
 # include "utils.hh"
+# include "Trace.hh"
+# include "Logging.hh"
 # include "coordinates/IsometricFrame.hh"
 
 namespace new_frontiers {
@@ -130,7 +132,7 @@ namespace new_frontiers {
     // fetch the visible elements and then paint
     // them.
     Viewport v = res.cf.cellsViewport();
-    std::vector<world::ItemEntry> items = res.loc->getVisible(
+    std::vector<world::ItemEntry> items = res.state.getVisible(
       v.p.x,
       v.p.y,
       v.p.x + v.dims.x,
@@ -140,12 +142,14 @@ namespace new_frontiers {
       world::Sort::ZOrder
     );
 
-    verbose(
+    NF_VERBOSE(
       "Fetched " + std::to_string(items.size()) + " element(s)" +
       " in viewport [" + std::to_string(v.p.x) + "," + std::to_string(v.p.y) +
       " : " + std::to_string(v.dims.x) + "x" + std::to_string(v.dims.y) + "]"
     );
 
+    TRACE_ZONE_ARG(zone, "isometric::paint", "items", items.size());
+
     SpriteDesc sd;
 
     // No matter what happens we can draw the ground
@@ -155,8 +159,8 @@ namespace new_frontiers {
     sd.radius = 1.0f;
     sd.location = Cell::TopLeft;
 
-    for (int y = 0 ; y < res.loc->h() ; ++y) {
-      for (int x = 0 ; x < res.loc->w() ; ++x) {
+    for (int y = 0 ; y < res.state.h() ; ++y) {
+      for (int x = 0 ; x < res.state.w() ; ++x) {
         sd.x = x;
         sd.y = y;
 
@@ -172,7 +176,7 @@ namespace new_frontiers {
 
       // Case of a block.
       if (ie.type == world::ItemType::Block) {
-        world::Block t = res.loc->block(ie.index);
+        const world::Block& t = res.state.block(ie.index);
 
         sd.alpha = ALPHA_OPAQUE;
         sd.radius = 1.0f;
@@ -182,8 +186,8 @@ namespace new_frontiers {
         sd.type = aliasOfBlock(t.tile.type);
 
         olc::Pixel p = olc::WHITE;
-        if (t.owner.valid()) {
-          p = getColorFor(t.owner.toString());
+        if (owner::valid(t.owner)) {
+          p = getColorFor(t.owner);
         }
         drawSprite(sd, res.cf, t.tile.id, p);
 
@@ -201,7 +205,7 @@ namespace new_frontiers {
 
       // Case of an entity.
       if (ie.type == world::ItemType::Entity) {
-        world::Entity t = res.loc->entity(ie.index);
+        const world::Entity& t = res.state.entity(ie.index);
 
         sd.radius = t.radius;
         sd.location = Cell::UpperLeft;
@@ -236,7 +240,7 @@ namespace new_frontiers {
 
       // Case of a VFX.
       if (ie.type == world::ItemType::VFX) {
-        world::VFX t = res.loc->vfx(ie.index);
+        const world::VFX& t = res.state.vfx(ie.index);
 
         sd.alpha = static_cast<int>(std::round(ALPHA_OPAQUE * t.amount));
         sd.radius = t.radius;
@@ -280,9 +284,9 @@ namespace new_frontiers {
     olc::Pixel bg(255, 255, 255, ALPHA_SEMI_OPAQUE);
     int tpSize = 20;
 
-    for (int id = 0 ; id < res.loc->coloniesCount() ; ++id) {
-      world::Colony c = res.loc->colony(id);
-      olc::vi2d idS = GetTextSize(c.id.toString());
+    for (int id = 0 ; id < res.state.coloniesCount() ; ++id) {
+      const world::Colony& c = res.state.colony(id);
+      olc::vi2d idS = GetTextSize(owner::name(c.id));
 
       olc::vi2d idFocus = GetTextSize(world::focusToString(c.focus));
 
@@ -294,10 +298,10 @@ namespace new_frontiers {
     FillRectDecal(olc::vf2d(), s, bg);
 
     olc::vf2d p(icOffset, cOffset);
-    for (int id = 0 ; id < res.loc->coloniesCount() ; ++id) {
-      world::Colony c = res.loc->colony(id);
+    for (int id = 0 ; id < res.state.coloniesCount() ; ++id) {
+      const world::Colony& c = res.state.colony(id);
 
-      std::string cID = c.id.toString();
+      const std::string& cID = owner::name(c.id);
 
       olc::vi2d idS = GetTextSize(cID);
 
@@ -310,7 +314,7 @@ namespace new_frontiers {
       }
 
       // Draw the colony's color.
-      olc::Pixel col = getColorFor(cID);
+      olc::Pixel col = getColorFor(c.id);
       FillRectDecal(p, olc::vf2d(colorSize, idS.y), col);
 
       // Draw the colony's identifier.
@@ -374,7 +378,7 @@ namespace new_frontiers {
     // Render entities path and position.
     Viewport v = res.cf.cellsViewport();
     world::ItemType ie = world::ItemType::Entity;
-    std::vector<world::ItemEntry> items = res.loc->getVisible(
+    std::vector<world::ItemEntry> items = res.state.getVisible(
       v.p.x,
       v.p.y,
       v.p.x + v.dims.x,
@@ -396,7 +400,7 @@ namespace new_frontiers {
         continue;
       }
 
-      world::Entity ed = res.loc->entity(ie.index);
+      const world::Entity& ed = res.state.entity(ie.index);
 
       olc::vf2d cb = res.cf.tileCoordsToPixels(ed.tile.p.x(), ed.tile.p.y(), ed.radius);
 
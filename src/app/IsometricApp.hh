@@ -4,6 +4,7 @@
 # include "PGEApp.hh"
 # include <unordered_map>
 # include "ColorGenerator.hh"
+# include "Logging.hh"
 
 namespace new_frontiers {
 
@@ -193,12 +194,12 @@ namespace new_frontiers {
        *          returned but this state won't be persisted
        *          giving a chance to restore the situation in
        *          the future.
-       * @param colony - the identifier of the colony for which
-       *                 a color should be generated as a string.
+       * @param colony - the owner index of the colony for which
+       *                 a color should be generated.
        * @return - the color for this colony.
        */
       olc::Pixel
-      getColorFor(const std::string& colony) noexcept;
+      getColorFor(OwnerId colony) noexcept;
 
     private:
 
@@ -206,7 +207,7 @@ namespace new_frontiers {
        * @brief - Convenience define to refer to the map of
        *          colors representing colonies.
        */
-      using ColorMap = std::unordered_map<std::string, olc::Pixel>;
+      using ColorMap = std::unordered_map<OwnerId, olc::Pixel>;
 
       /**
        * @brief - Convenience enumeration to refer to the position of
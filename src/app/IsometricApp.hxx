@@ -75,7 +75,7 @@ namespace new_frontiers {
 
   inline
   olc::Pixel
-  IsometricApp::getColorFor(const std::string& colony) noexcept {
+  IsometricApp::getColorFor(OwnerId colony) noexcept {
     // Fetch from exsisting.
     ColorMap::const_iterator it = m_coloniesColors.find(colony);
     if (it != m_coloniesColors.cend()) {
@@ -84,10 +84,10 @@ namespace new_frontiers {
 
     // Otherwise generate a new one.
     bool failed;
-    olc::Pixel col = m_cGenerator.generate(colony, failed);
+    olc::Pixel col = m_cGenerator.generate(owner::name(colony), failed);
 
     if (failed) {
-      debug("Failed to generate color for \"" + colony + "\"");
+      NF_DEBUG("Failed to generate color for \"" + owner::name(colony) + "\"");
       col = olc::WHITE;
     }
     else {
@@ -1,6 +1,8 @@
 
 # include "TopViewApp.hh"
 # include "utils.hh"
+# include "Trace.hh"
+# include "Logging.hh"
 # include "coordinates/TopViewFrame.hh"
 
 namespace new_frontiers {
@@ -45,7 +47,7 @@ namespace new_frontiers {
     // fetch the visible elements and then paint
     // them.
     Viewport v = res.cf.cellsViewport();
-    std::vector<world::ItemEntry> items = res.loc->getVisible(
+    std::vector<world::ItemEntry> items = res.state.getVisible(
       v.p.x,
       v.p.y,
       v.p.x + v.dims.x,
@@ -55,12 +57,14 @@ namespace new_frontiers {
       world::Sort::ZOrder
     );
 
-    verbose(
+    NF_VERBOSE(
       "Fetched " + std::to_string(items.size()) + " element(s)" +
       " in viewport [" + std::to_string(v.p.x) + "," + std::to_string(v.p.y) +
       " : " + std::to_string(v.dims.x) + "x" + std::to_string(v.dims.y) + "]"
     );
 
+    TRACE_ZONE_ARG(zone, "topview::paint", "items", items.size());
+
     SpriteDesc sd;
 
     // No matter what happens we can draw the ground
@@ -70,8 +74,8 @@ namespace new_frontiers {
     sd.radius = 1.0f;
     sd.location = Cell::TopLeft;
 
-    for (int y = 0 ; y < res.loc->h() ; ++y) {
-      for (int x = 0 ; x < res.loc->w() ; ++x) {
+    for (int y = 0 ; y < res.state.h() ; ++y) {
+      for (int x = 0 ; x < res.state.w() ; ++x) {
         sd.x = x;
         sd.y = y;
 
@@ -87,7 +91,7 @@ namespace new_frontiers {
 
       // Case of a block.
       if (ie.type == world::ItemType::Block) {
-        world::Block t = res.loc->block(ie.index);
+        const world::Block& t = res.state.block(ie.index);
 
         sd.alpha = ALPHA_OPAQUE;
         sd.radius = 1.0f;
@@ -117,7 +121,7 @@ namespace new_frontiers {
 
       // Case of an entity.
       if (ie.type == world::ItemType::Entity) {
-        world::Entity t = res.loc->entity(ie.index);
+        const world::Entity& t = res.state.entity(ie.index);
 
         sd.radius = t.radius;
         sd.location = Cell::UpperTopLeft;
@@ -152,7 +156,7 @@ namespace new_frontiers {
 
       // Case of a VFX.
       if (ie.type == world::ItemType::VFX) {
-        world::VFX t = res.loc->vfx(ie.index);
+        const world::VFX& t = res.state.vfx(ie.index);
 
         sd.alpha = static_cast<int>(std::round(ALPHA_OPAQUE * t.amount));
         sd.radius = t.radius;
@@ -195,9 +199,9 @@ namespace new_frontiers {
     olc::Pixel bg(255, 255, 255, ALPHA_SEMI_OPAQUE);
     int tpSize = 20;
 
-    for (int id = 0 ; id < res.loc->coloniesCount() ; ++id) {
-      world::Colony c = res.loc->colony(id);
-      olc::vi2d idS = GetTextSize(c.id.toString());
+    for (int id = 0 ; id < res.state.coloniesCount() ; ++id) {
+      const world::Colony& c = res.state.colony(id);
+      olc::vi2d idS = GetTextSize(owner::name(c.id));
 
       olc::vi2d idFocus = GetTextSize(world::focusToString(c.focus));
 
@@ -208,13 +212,13 @@ namespace new_frontiers {
     FillRectDecal(olc::vf2d(), s, bg);
 
     olc::vf2d p;
-    for (int id = 0 ; id < res.loc->coloniesCount() ; ++id) {
-      world::Colony c = res.loc->colony(id);
+    for (int id = 0 ; id < res.state.coloniesCount() ; ++id) {
+      const world::Colony& c = res.state.colony(id);
 
       // Draw the colony's identifier.
-      DrawStringDecal(p, c.id.toString());
+      DrawStringDecal(p, owner::name(c.id));
 
-      olc::vi2d idS = GetTextSize(c.id.toString());
+      olc::vi2d idS = GetTextSize(owner::name(c.id));
 
       // Draw the bar corresponding to the resource
       // budget.
@@ -273,7 +277,7 @@ namespace new_frontiers {
     // Render entities path and position.
     Viewport v = res.cf.cellsViewport();
     world::ItemType ie = world::ItemType::Entity;
-    std::vector<world::ItemEntry> items = res.loc->getVisible(
+    std::vector<world::ItemEntry> items = res.state.getVisible(
       v.p.x,
       v.p.y,
       v.p.x + v.dims.x,
@@ -295,7 +299,7 @@ namespace new_frontiers {
         continue;
       }
 
-      world::Entity ed = res.loc->entity(ie.index);
+      const world::Entity& ed = res.state.entity(ie.index);
 
       olc::vf2d tl = res.cf.tileCoordsToPixels(ed.tile.p.x(), ed.tile.p.y(), ed.radius, Cell::TopLeft);
 
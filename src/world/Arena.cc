@@ -0,0 +1,81 @@
+
+# include "Arena.hh"
+# include <new>
+# include <memory>
+# include <algorithm>
+
+namespace new_frontiers {
+
+  const std::size_t Arena::sk_blockSize = 64u * 1024u;
+
+  Arena::Arena():
+    std::pmr::memory_resource(),
+
+    m_blocks(),
+
+    m_current(0u),
+    m_offset(0u),
+
+    m_used(0u),
+    m_highWater(0u)
+  {}
+
+  Arena::~Arena() {
+    for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
+      ::operator delete(m_blocks[id].data);
+    }
+  }
+
+  std::size_t
+  Arena::capacity() const noexcept {
+    std::size_t total = 0u;
+    for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
+      total += m_blocks[id].size;
+    }
+
+    return total;
+  }
+
+  void*
+  Arena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // Look for room in the current block and the ones
+    // following it: blocks too small for the request
+    // are skipped until the next reset.
+    while (m_current < m_blocks.size()) {
+      Block& b = m_blocks[m_current];
+
+      void* p = b.data + m_offset;
+      std::size_t space = b.size - m_offset;
+
+      if (std::align(alignment, bytes, p, space) != nullptr) {
+        m_offset = b.size - space + bytes;
+
+        m_used += bytes;
+        m_highWater = std::max(m_highWater, m_used);
+
+        return p;
+      }
+
+      ++m_current;
+      m_offset = 0u;
+    }
+
+    // No block can serve the request: allocate a new
+    // one large enough for it.
+    std::size_t size = std::max(sk_blockSize, bytes + alignment);
+    m_blocks.push_back(Block{static_cast<unsigned char*>(::operator new(size)), size});
+
+    return do_allocate(bytes, alignment);
+  }
+
+  void
+  Arena::do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) {
+    // Memory is reclaimed when the arena is reset.
+  }
+
+  bool
+  Arena::do_is_equal(const std::pmr::memory_resource& rhs) const noexcept {
+    return this == &rhs;
+  }
+
+}
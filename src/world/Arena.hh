@@ -0,0 +1,119 @@
+#ifndef    ARENA_HH
+# define   ARENA_HH
+
+# include <vector>
+# include <cstddef>
+# include <memory_resource>
+
+namespace new_frontiers {
+
+  /**
+   * @brief - A memory resource serving the transient containers
+   *          built while stepping the world (results of queries,
+   *          candidate paths, etc.). Allocations are served by
+   *          bumping a pointer in large blocks and releasing the
+   *          memory does nothing: everything is reclaimed at once
+   *          when the arena is reset at the end of a step.
+   *          Blocks are kept across resets so that once the arena
+   *          reached the size needed by a step, the next ones do
+   *          not request memory from the system anymore.
+   *          An arena is not thread safe: each chunk of elements
+   *          stepped concurrently uses its own.
+   */
+  class Arena: public std::pmr::memory_resource {
+    public:
+
+      /**
+       * @brief - Create a new empty arena: no memory is allocated
+       *          until the first request.
+       */
+      Arena();
+
+      /**
+       * @brief - Destruction of the arena: releases all the blocks.
+       *          Memory served by the arena should not be used any
+       *          more.
+       */
+      ~Arena();
+
+      Arena(const Arena&) = delete;
+
+      Arena&
+      operator=(const Arena&) = delete;
+
+      /**
+       * @brief - Make all the memory of the arena available again
+       *          for the next allocations. Blocks are kept.
+       */
+      void
+      reset() noexcept;
+
+      /**
+       * @brief - The total size of the blocks allocated from the
+       *          system.
+       * @return - the capacity of the arena in bytes.
+       */
+      std::size_t
+      capacity() const noexcept;
+
+      /**
+       * @brief - The highest number of bytes served between two
+       *          resets since the creation of the arena.
+       * @return - the high water mark in bytes.
+       */
+      std::size_t
+      highWater() const noexcept;
+
+    protected:
+
+      void*
+      do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+      void
+      do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+      bool
+      do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override;
+
+    private:
+
+      /**
+       * @brief - Convenience structure describing a block of
+       *          memory of the arena.
+       */
+      struct Block {
+        unsigned char* data;
+        std::size_t size;
+      };
+
+      /**
+       * @brief - The minimum size of a block in bytes.
+       */
+      static const std::size_t sk_blockSize;
+
+      /**
+       * @brief - The blocks of the arena, in the order in which
+       *          they are used.
+       */
+      std::vector<Block> m_blocks;
+
+      /**
+       * @brief - The block currently used and the offset of the
+       *          first free byte in it.
+       */
+      std::size_t m_current;
+      std::size_t m_offset;
+
+      /**
+       * @brief - The number of bytes served since the last reset
+       *          and the highest value it reached.
+       */
+      std::size_t m_used;
+      std::size_t m_highWater;
+  };
+
+}
+
+# include "Arena.hxx"
+
+#endif    /* ARENA_HH */
@@ -0,0 +1,24 @@
+#ifndef    ARENA_HXX
+# define   ARENA_HXX
+
+# include "Arena.hh"
+
+namespace new_frontiers {
+
+  inline
+  void
+  Arena::reset() noexcept {
+    m_current = 0u;
+    m_offset = 0u;
+    m_used = 0u;
+  }
+
+  inline
+  std::size_t
+  Arena::highWater() const noexcept {
+    return m_highWater;
+  }
+
+}
+
+#endif    /* ARENA_HXX */
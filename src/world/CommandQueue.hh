@@ -0,0 +1,85 @@
+#ifndef    COMMAND_QUEUE_HH
+# define   COMMAND_QUEUE_HH
+
+# include <atomic>
+# include <memory>
+# include <vector>
+# include <functional>
+
+namespace new_frontiers {
+
+  // Forward declaration of the world to be able to define
+  // commands operating on it.
+  class World;
+
+  /**
+   * @brief - A bounded lock-free queue of commands to apply on
+   *          a world. It is meant to be used by exactly one
+   *          producer thread (typically the rendering thread
+   *          forwarding user actions) and one consumer thread
+   *          (the one stepping the world).
+   */
+  class CommandQueue {
+    public:
+
+      /**
+       * @brief - Convenience define for a command: it receives
+       *          the world onto which it should be applied.
+       */
+      using Command = std::function<void(World&)>;
+
+      /**
+       * @brief - Create a new queue able to hold at most the
+       *          specified number of pending commands.
+       * @param capacity - the maximum number of commands that
+       *                   can be pending in the queue.
+       */
+      CommandQueue(unsigned capacity);
+
+      /**
+       * @brief - Append a new command to the queue. Should only
+       *          be called by the producer thread.
+       * @param cmd - the command to append.
+       * @return - `false` if the queue is full, in which case the
+       *           command is not registered.
+       */
+      bool
+      push(Command cmd);
+
+      /**
+       * @brief - Retrieve the oldest command of the queue. Should
+       *          only be called by the consumer thread.
+       * @param cmd - output argument holding the command if any.
+       * @return - `false` if the queue is empty.
+       */
+      bool
+      pop(Command& cmd);
+
+    private:
+
+      /**
+       * @brief - The storage for commands. One slot is always
+       *          left empty to distinguish a full queue from an
+       *          empty one.
+       */
+      std::vector<Command> m_commands;
+
+      /**
+       * @brief - The index of the next command to pop. Only
+       *          written by the consumer.
+       */
+      std::atomic<unsigned> m_head;
+
+      /**
+       * @brief - The index of the next slot to push into. Only
+       *          written by the producer.
+       */
+      std::atomic<unsigned> m_tail;
+  };
+
+  using CommandQueueShPtr = std::shared_ptr<CommandQueue>;
+}
+
+# include "CommandQueue.hxx"
+
+#endif    /* COMMAND_QUEUE_HH */
@@ -0,0 +1,50 @@
+#ifndef    COMMAND_QUEUE_HXX
+# define   COMMAND_QUEUE_HXX
+
+# include "CommandQueue.hh"
+
+namespace new_frontiers {
+
+  inline
+  CommandQueue::CommandQueue(unsigned capacity):
+    m_commands(capacity + 1u),
+
+    m_head(0u),
+    m_tail(0u)
+  {}
+
+  inline
+  bool
+  CommandQueue::push(Command cmd) {
+    unsigned tail = m_tail.load(std::memory_order_relaxed);
+    unsigned next = (tail + 1u) % m_commands.size();
+
+    if (next == m_head.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    m_commands[tail] = std::move(cmd);
+    m_tail.store(next, std::memory_order_release);
+
+    return true;
+  }
+
+  inline
+  bool
+  CommandQueue::pop(Command& cmd) {
+    unsigned head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    cmd = std::move(m_commands[head]);
+    m_commands[head] = nullptr;
+    m_head.store((head + 1u) % m_commands.size(), std::memory_order_release);
+
+    return true;
+  }
+
+}
+
+#endif    /* COMMAND_QUEUE_HXX */
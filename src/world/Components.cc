@@ -0,0 +1,204 @@
+
+# include "Components.hh"
+# include <algorithm>
+# include "Influence.hh"
+# include "effects/EvaporatingVFX.hh"
+# include "entities/Mob.hh"
+
+namespace new_frontiers {
+
+  Components::Components():
+    utils::CoreObject("components"),
+
+    m_effects(),
+    m_amounts(),
+    m_rates(),
+
+    m_entities(),
+    m_positions(),
+    m_owners(),
+    m_energies(),
+    m_refills(),
+    m_maxEnergies()
+  {
+    setService("world");
+  }
+
+  Components::~Components() {
+    clear();
+  }
+
+  void
+  Components::attach(EvaporatingVFX& effect) {
+    if (effect.m_components != nullptr) {
+      warn("Effect " + std::to_string(effect.getId()) + " is already attached to components");
+      return;
+    }
+
+    m_effects.push_back(&effect);
+    m_amounts.push_back(effect.m_amount);
+    m_rates.push_back(effect.getEvaporation());
+
+    effect.m_components = this;
+    effect.m_slot = m_effects.size() - 1u;
+  }
+
+  void
+  Components::detach(VFX& effect) noexcept {
+    if (effect.m_components != this) {
+      return;
+    }
+
+    unsigned slot = effect.m_slot;
+    unsigned last = m_effects.size() - 1u;
+
+    effect.m_amount = m_amounts[slot];
+    effect.m_components = nullptr;
+
+    if (slot != last) {
+      m_effects[slot] = m_effects[last];
+      m_amounts[slot] = m_amounts[last];
+      m_rates[slot] = m_rates[last];
+
+      m_effects[slot]->m_slot = slot;
+    }
+
+    m_effects.pop_back();
+    m_amounts.pop_back();
+    m_rates.pop_back();
+  }
+
+  void
+  Components::clear() noexcept {
+    for (unsigned id = 0u ; id < m_effects.size() ; ++id) {
+      m_effects[id]->m_amount = m_amounts[id];
+      m_effects[id]->m_components = nullptr;
+    }
+
+    m_effects.clear();
+    m_amounts.clear();
+    m_rates.clear();
+
+    detachEntities();
+  }
+
+  void
+  Components::attach(Entity& entity) {
+    if (entity.m_components != nullptr) {
+      warn("Entity " + std::to_string(entity.getId()) + " is already attached to components");
+      return;
+    }
+
+    // Only mobs use energy: other entities get a null
+    // maximum so that refilling them has no effect.
+    Mob* m = dynamic_cast<Mob*>(&entity);
+
+    m_entities.push_back(&entity);
+    m_positions.push_back(entity.getTile().p);
+    m_owners.push_back(entity.getOwner());
+    m_energies.push_back(m != nullptr ? m->m_energy : 0.0f);
+    m_refills.push_back(m != nullptr ? entity.getArchetype().refill : 0.0f);
+    m_maxEnergies.push_back(m != nullptr ? entity.getArchetype().maxEnergy : 0.0f);
+
+    entity.m_components = this;
+    entity.m_slot = m_entities.size() - 1u;
+  }
+
+  void
+  Components::detachEntities() noexcept {
+    for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
+      Mob* m = dynamic_cast<Mob*>(m_entities[id]);
+      if (m != nullptr) {
+        m->m_energy = m_energies[id];
+      }
+
+      m_entities[id]->m_components = nullptr;
+    }
+
+    m_entities.clear();
+    m_positions.clear();
+    m_owners.clear();
+    m_energies.clear();
+    m_refills.clear();
+    m_maxEnergies.clear();
+  }
+
+  void
+  Components::compactEntities() noexcept {
+    // Same process as the compaction of the entities in
+    // the world so that slots still match their index.
+    unsigned kept = 0u;
+
+    for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
+      if (m_entities[id]->isRemoved()) {
+        m_entities[id]->m_components = nullptr;
+        continue;
+      }
+
+      if (kept != id) {
+        m_entities[kept] = m_entities[id];
+        m_positions[kept] = m_positions[id];
+        m_owners[kept] = m_owners[id];
+        m_energies[kept] = m_energies[id];
+        m_refills[kept] = m_refills[id];
+        m_maxEnergies[kept] = m_maxEnergies[id];
+
+        m_entities[kept]->m_slot = kept;
+      }
+      ++kept;
+    }
+
+    m_entities.resize(kept);
+    m_positions.resize(kept);
+    m_owners.resize(kept);
+    m_energies.resize(kept);
+    m_refills.resize(kept);
+    m_maxEnergies.resize(kept);
+  }
+
+  void
+  Components::evaporate(unsigned begin,
+                        unsigned end,
+                        float elapsed,
+                        std::vector<Influence>& influences) noexcept
+  {
+    // This is the same process as `VFX::step` for an
+    // evaporating effect: effects which are exhausted
+    // are removed, the others lose some amount.
+    for (unsigned id = begin ; id < end ; ++id) {
+      if (m_amounts[id] <= 0.0f) {
+        m_effects[id]->markForDeletion(true);
+        influences.emplace_back(influence::Type::VFXRemoval, m_effects[id]->getHandle());
+
+        continue;
+      }
+
+      m_amounts[id] = std::min(std::max(m_amounts[id] - elapsed * m_rates[id], 0.0f), 1.0f);
+    }
+  }
+
+  void
+  Components::refill(unsigned begin, unsigned end, float elapsed) noexcept {
+    for (unsigned id = begin ; id < end ; ++id) {
+      m_energies[id] = std::min(m_energies[id] + elapsed * m_refills[id], m_maxEnergies[id]);
+    }
+  }
+
+  void
+  Components::move(unsigned begin, unsigned end, float elapsed) noexcept {
+    // This is the motion performed at the end of the
+    // `Entity::step` method followed by the `commit`.
+    for (unsigned id = begin ; id < end ; ++id) {
+      Entity& e = *m_entities[id];
+      float arrival = e.getArchetype().arrival;
+
+      if (e.m_path.enRoute(arrival)) {
+        e.m_path.advance(e.m_speed, elapsed, arrival);
+      }
+
+      e.commit();
+      m_positions[id] = e.m_path.cur;
+    }
+  }
+
+}
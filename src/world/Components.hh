@@ -0,0 +1,247 @@
+#ifndef    COMPONENTS_HH
+# define   COMPONENTS_HH
+
+# include <vector>
+# include <core_utils/CoreObject.hh>
+# include <maths_utils/Point2.hh>
+# include "Owner.hh"
+
+namespace new_frontiers {
+
+  /// Forward declaration of the classes used by the
+  /// components to avoid circular dependencies.
+  class VFX;
+  class EvaporatingVFX;
+  class Entity;
+  class Influence;
+
+  /**
+   * @brief - Stores the state of the evaporating effects and
+   *          the position and energy of entities in contiguous
+   *          arrays rather than in the elements so that they
+   *          can be updated by a single linear loop instead of
+   *          stepping each element through a virtual call.
+   *          An effect attached to the components reads its
+   *          amount from them: it should not be stepped while
+   *          it is attached.
+   *          Entities are kept in the order they are attached
+   *          so that the slot of an entity is its index in the
+   *          list of entities of the world. An attached entity
+   *          reads its energy from the components and does not
+   *          move along its path by itself: `move` does it.
+   */
+  class Components: public utils::CoreObject {
+    public:
+
+      /**
+       * @brief - Create new empty components.
+       */
+      Components();
+
+      /**
+       * @brief - Desctruction of the components: any effect still
+       *          attached is detached.
+       */
+      ~Components();
+
+      /**
+       * @brief - The number of effects attached to the components.
+       * @return - the number of effects.
+       */
+      std::size_t
+      size() const noexcept;
+
+      /**
+       * @brief - The amount of the effect at the specified slot.
+       * @param slot - the slot of the effect.
+       * @return - the amount of the effect.
+       */
+      float
+      amount(unsigned slot) const noexcept;
+
+      /**
+       * @brief - Attach the effect to the components: its state is
+       *          copied in the arrays and updated by `evaporate`
+       *          until it is detached.
+       * @param effect - the effect to attach.
+       */
+      void
+      attach(EvaporatingVFX& effect);
+
+      /**
+       * @brief - Detach the effect from the components if it is
+       *          attached to them: its amount is written back in
+       *          the effect. The last effect is moved in the slot
+       *          of this one so the order of effects changes.
+       * @param effect - the effect to detach.
+       */
+      void
+      detach(VFX& effect) noexcept;
+
+      /**
+       * @brief - Detach all the effects and entities.
+       */
+      void
+      clear() noexcept;
+
+      /**
+       * @brief - The number of entities attached to the components.
+       * @return - the number of entities.
+       */
+      std::size_t
+      entities() const noexcept;
+
+      /**
+       * @brief - The last published position of the entity at
+       *          the specified slot.
+       * @param slot - the slot of the entity.
+       * @return - the position of the entity.
+       */
+      const utils::Point2f&
+      position(unsigned slot) const noexcept;
+
+      /**
+       * @brief - The owner of the entity at the specified slot.
+       * @param slot - the slot of the entity.
+       * @return - the owner of the entity.
+       */
+      OwnerId
+      owner(unsigned slot) const noexcept;
+
+      /**
+       * @brief - The energy of the entity at the specified slot.
+       * @param slot - the slot of the entity.
+       * @return - the energy of the entity.
+       */
+      float
+      energy(unsigned slot) const noexcept;
+
+      /**
+       * @brief - Consume some energy of the entity at the slot.
+       * @param slot - the slot of the entity.
+       * @param amount - the energy to consume.
+       */
+      void
+      spend(unsigned slot, float amount) noexcept;
+
+      /**
+       * @brief - Attach the entity to the components after the
+       *          ones already attached: its position and energy
+       *          are copied in the arrays.
+       * @param entity - the entity to attach.
+       */
+      void
+      attach(Entity& entity);
+
+      /**
+       * @brief - Detach all the entities: their energy is written
+       *          back in each of them.
+       */
+      void
+      detachEntities() noexcept;
+
+      /**
+       * @brief - Discard the entities marked for removal in a
+       *          single pass, preserving the order of the other
+       *          ones. It should be called before they are also
+       *          removed from the world.
+       */
+      void
+      compactEntities() noexcept;
+
+      /**
+       * @brief - Replenish the energy of the entities in the range
+       *          `[begin; end)` for the specified duration. This
+       *          is the same as what `Mob::prepareForStep` does
+       *          for entities which are not attached.
+       *          Ranges which do not overlap can be processed
+       *          concurrently.
+       * @param begin - the first slot to process.
+       * @param end - the slot past the last one to process.
+       * @param elapsed - the time elapsed since the last step.
+       */
+      void
+      refill(unsigned begin, unsigned end, float elapsed) noexcept;
+
+      /**
+       * @brief - Move the entities in the range `[begin; end)`
+       *          along their path for the specified duration and
+       *          publish the position they reached.
+       *          Ranges which do not overlap can be processed
+       *          concurrently.
+       * @param begin - the first slot to process.
+       * @param end - the slot past the last one to process.
+       * @param elapsed - the time elapsed since the last step.
+       */
+      void
+      move(unsigned begin, unsigned end, float elapsed) noexcept;
+
+      /**
+       * @brief - Make the effects in the range `[begin; end)`
+       *          evaporate for the specified duration. Effects
+       *          which already evaporated completely are marked
+       *          for deletion and a removal influence is created
+       *          for each one of them.
+       *          Ranges which do not overlap can be processed
+       *          concurrently.
+       * @param begin - the first slot to process.
+       * @param end - the slot past the last one to process.
+       * @param elapsed - the time elapsed since the last step.
+       * @param influences - the list to which influences are
+       *                     appended.
+       */
+      void
+      evaporate(unsigned begin,
+                unsigned end,
+                float elapsed,
+                std::vector<Influence>& influences) noexcept;
+
+    private:
+
+      /**
+       * @brief - The effects attached to the components.
+       */
+      std::vector<VFX*> m_effects;
+
+      /**
+       * @brief - The remaining amount of each effect.
+       */
+      std::vector<float> m_amounts;
+
+      /**
+       * @brief - The evaporation rate of each effect in units
+       *          per second.
+       */
+      std::vector<float> m_rates;
+
+      /**
+       * @brief - The entities attached to the components.
+       */
+      std::vector<Entity*> m_entities;
+
+      /**
+       * @brief - The published position of each entity.
+       */
+      std::vector<utils::Point2f> m_positions;
+
+      /**
+       * @brief - The owner of each entity.
+       */
+      std::vector<OwnerId> m_owners;
+
+      /**
+       * @brief - The energy of each entity along with the rate
+       *          at which it is replenished in units per second
+       *          and the maximum it can reach. Entities which
+       *          do not use energy have a null maximum.
+       */
+      std::vector<float> m_energies;
+      std::vector<float> m_refills;
+      std::vector<float> m_maxEnergies;
+  };
+
+}
+
+# include "Components.hxx"
+
+#endif    /* COMPONENTS_HH */
@@ -0,0 +1,52 @@
+#ifndef    COMPONENTS_HXX
+# define   COMPONENTS_HXX
+
+# include "Components.hh"
+
+namespace new_frontiers {
+
+  inline
+  std::size_t
+  Components::size() const noexcept {
+    return m_effects.size();
+  }
+
+  inline
+  float
+  Components::amount(unsigned slot) const noexcept {
+    return m_amounts[slot];
+  }
+
+  inline
+  std::size_t
+  Components::entities() const noexcept {
+    return m_entities.size();
+  }
+
+  inline
+  const utils::Point2f&
+  Components::position(unsigned slot) const noexcept {
+    return m_positions[slot];
+  }
+
+  inline
+  OwnerId
+  Components::owner(unsigned slot) const noexcept {
+    return m_owners[slot];
+  }
+
+  inline
+  float
+  Components::energy(unsigned slot) const noexcept {
+    return m_energies[slot];
+  }
+
+  inline
+  void
+  Components::spend(unsigned slot, float amount) noexcept {
+    m_energies[slot] -= amount;
+  }
+
+}
+
+#endif    /* COMPONENTS_HXX */
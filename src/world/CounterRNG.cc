@@ -0,0 +1,70 @@
+
+# include "CounterRNG.hh"
+
+namespace {
+
+  /// @brief - Multipliers and key increments of the
+  /// Philox 4x32 bijection as defined in the paper
+  /// 'Parallel random numbers: as easy as 1, 2, 3'.
+  constexpr std::uint32_t sk_m0 = 0xD2511F53u;
+  constexpr std::uint32_t sk_m1 = 0xCD9E8D57u;
+  constexpr std::uint32_t sk_w0 = 0x9E3779B9u;
+  constexpr std::uint32_t sk_w1 = 0xBB67AE85u;
+
+  constexpr unsigned sk_rounds = 10u;
+
+  inline
+  void
+  mulhilo(std::uint32_t a,
+          std::uint32_t b,
+          std::uint32_t& hi,
+          std::uint32_t& lo) noexcept
+  {
+    std::uint64_t p = static_cast<std::uint64_t>(a) * b;
+
+    hi = static_cast<std::uint32_t>(p >> 32u);
+    lo = static_cast<std::uint32_t>(p);
+  }
+
+}
+
+namespace new_frontiers {
+
+  std::uint32_t
+  CounterRNG::next() noexcept {
+    // The counter is made of the draw index, the tick
+    // and the upper part of the stream while the key
+    // is made of the lower part of the stream and the
+    // seed.
+    std::uint32_t c[4] = {
+      m_draw,
+      static_cast<std::uint32_t>(m_tick),
+      static_cast<std::uint32_t>(m_tick >> 32u),
+      static_cast<std::uint32_t>(m_stream >> 32u)
+    };
+
+    std::uint32_t k[2] = {
+      static_cast<std::uint32_t>(m_stream),
+      m_seed
+    };
+
+    for (unsigned id = 0u ; id < sk_rounds ; ++id) {
+      std::uint32_t hi0, lo0, hi1, lo1;
+      mulhilo(sk_m0, c[0], hi0, lo0);
+      mulhilo(sk_m1, c[2], hi1, lo1);
+
+      c[0] = hi1 ^ c[1] ^ k[0];
+      c[1] = lo1;
+      c[2] = hi0 ^ c[3] ^ k[1];
+      c[3] = lo0;
+
+      k[0] += sk_w0;
+      k[1] += sk_w1;
+    }
+
+    ++m_draw;
+
+    return c[0];
+  }
+
+}
@@ -0,0 +1,106 @@
+#ifndef    COUNTER_RNG_HH
+# define   COUNTER_RNG_HH
+
+# include <cstdint>
+# include <memory>
+
+namespace new_frontiers {
+
+  /**
+   * @brief - A counter-based random number generator based
+   *          on the Philox 4x32-10 bijection. Each draw is a
+   *          pure function of the seed, the stream (usually
+   *          the identifier of an element of the world), the
+   *          tick and the index of the draw within the tick.
+   *          This allows elements to get the same sequence
+   *          of values no matter the order or the thread in
+   *          which they are evaluated.
+   */
+  class CounterRNG {
+    public:
+
+      /**
+       * @brief - Create a new generator with the specified seed.
+       *          The generator starts at the tick `0` and on the
+       *          stream `0`.
+       * @param seed - the seed of the generator.
+       */
+      CounterRNG(int seed = 0) noexcept;
+
+      /**
+       * @brief - Move to the next tick: this also restarts the
+       *          current stream from its first draw.
+       */
+      void
+      advance() noexcept;
+
+      /**
+       * @brief - Select the stream to use for the following draws
+       *          and restart it from its first draw for the tick.
+       * @param stream - the identifier of the stream.
+       */
+      void
+      reset(std::uint64_t stream) noexcept;
+
+      /**
+       * @brief - Generate a random float value in the interval
+       *          `[min; max)`.
+       * @param min - the lower bound of the interval.
+       * @param max - the upper bound of the interval.
+       * @return - the generated value.
+       */
+      float
+      rndFloat(float min = 0.0f, float max = 1.0f) noexcept;
+
+      /**
+       * @brief - Generate a random angle in the interval `[min;
+       *          max)`. The default interval covers a full turn.
+       * @param min - the lower bound of the interval.
+       * @param max - the upper bound of the interval.
+       * @return - the generated angle in radians.
+       */
+      float
+      rndAngle(float min = 0.0f, float max = 6.2831853f) noexcept;
+
+    private:
+
+      /**
+       * @brief - Used to produce the next 32 bits of randomness
+       *          for the current stream and tick and increment
+       *          the draw index.
+       * @return - the random bits.
+       */
+      std::uint32_t
+      next() noexcept;
+
+    private:
+
+      /**
+       * @brief - The seed of the generator: used as part of the
+       *          key of the bijection.
+       */
+      std::uint32_t m_seed;
+
+      /**
+       * @brief - The current tick.
+       */
+      std::uint64_t m_tick;
+
+      /**
+       * @brief - The current stream.
+       */
+      std::uint64_t m_stream;
+
+      /**
+       * @brief - The index of the next draw in the current stream
+       *          for the current tick.
+       */
+      std::uint32_t m_draw;
+  };
+
+  using CounterRNGShPtr = std::shared_ptr<CounterRNG>;
+}
+
+# include "CounterRNG.hxx"
+
+#endif    /* COUNTER_RNG_HH */
@@ -0,0 +1,49 @@
+#ifndef    COUNTER_RNG_HXX
+# define   COUNTER_RNG_HXX
+
+# include "CounterRNG.hh"
+
+namespace new_frontiers {
+
+  inline
+  CounterRNG::CounterRNG(int seed) noexcept:
+    m_seed(static_cast<std::uint32_t>(seed)),
+    m_tick(0u),
+    m_stream(0u),
+    m_draw(0u)
+  {}
+
+  inline
+  void
+  CounterRNG::advance() noexcept {
+    ++m_tick;
+    m_draw = 0u;
+  }
+
+  inline
+  void
+  CounterRNG::reset(std::uint64_t stream) noexcept {
+    m_stream = stream;
+    m_draw = 0u;
+  }
+
+  inline
+  float
+  CounterRNG::rndFloat(float min, float max) noexcept {
+    // Keep the 24 most significant bits: this is the
+    // precision of the mantissa of a float and it is
+    // guaranteed to produce a value in `[0; 1)`.
+    float u = (next() >> 8u) * (1.0f / 16777216.0f);
+
+    return min + u * (max - min);
+  }
+
+  inline
+  float
+  CounterRNG::rndAngle(float min, float max) noexcept {
+    return rndFloat(min, max);
+  }
+
+}
+
+#endif    /* COUNTER_RNG_HXX */
@@ -2,7 +2,6 @@
 # define   ELEMENT_HH
 
 # include <core_utils/CoreObject.hh>
-# include <core_utils/Uuid.hh>
 # include "Tiles.hh"
 # include <core_utils/TimeUtils.hh>
 # include "StepInfo.hh"
@@ -47,6 +46,13 @@ namespace new_frontiers {
       float
       getHealthRatio();
 
+      /**
+       * @brief - Return the current health of this element.
+       * @return - the health of this element.
+       */
+      float
+      getHealth() const noexcept;
+
       /**
        * @brief - Return `true` in case this element is marked
        *          for deletion and will probably be removed in
@@ -81,18 +87,17 @@ namespace new_frontiers {
        * @param radius - the radius for this entity expressed
        *                 in blocks.
        * @param health - the health pool for this element.
-       * @param name - the name of the object (mainly used for
-       *               logging purposes).
-       * @param owner - the identifier of the owner of this
-       *                element. It is assigned to a null value
-       *                by default, meaning that the element is
-       *                not owned.
+       * @param logger - the logger shared by the elements of the
+       *                 category of this one.
+       * @param owner - the index of the owner of this element.
+       *                It is assigned to `none` by default,
+       *                meaning that the element is not owned.
        */
       Element(const Tile<TileType>& tile,
               float radius,
               float health,
-              const std::string& name,
-              const utils::Uuid& owner = utils::Uuid());
+              const ElementLogger& logger,
+              OwnerId owner = owner::none);
 
       /**
        * @brief - Used to mark or remove this element from
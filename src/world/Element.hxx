@@ -26,6 +26,13 @@ namespace new_frontiers {
     return m_radius;
   }
 
+  template <typename TileType>
+  inline
+  float
+  Element<TileType>::getHealth() const noexcept {
+    return m_health;
+  }
+
   template <typename TileType>
   inline
   float
@@ -67,9 +74,9 @@ namespace new_frontiers {
   Element<TileType>::Element(const Tile<TileType>& desc,
                              float radius,
                              float health,
-                             const std::string& name,
-                             const utils::Uuid& owner):
-    WorldElement(name, owner),
+                             const ElementLogger& logger,
+                             OwnerId owner):
+    WorldElement(logger, owner),
 
     m_tile(desc),
 
@@ -80,9 +87,7 @@ namespace new_frontiers {
     m_totalHealth(m_health),
 
     m_toBeDeleted(false)
-  {
-    setService("element");
-  }
+  {}
 
   template <typename TileType>
   inline
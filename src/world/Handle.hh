@@ -0,0 +1,160 @@
+#ifndef    HANDLE_HH
+# define   HANDLE_HH
+
+# include <memory>
+# include <vector>
+# include <cstdint>
+
+namespace new_frontiers {
+
+  // Forward declaration of the elements which can be
+  // referred to through a handle.
+  class Block;
+  class Entity;
+  class VFX;
+
+  /**
+   * @brief - A reference to an element of the world made of the
+   *          index of the slot of the element in a table and the
+   *          generation of this slot when the element was put in
+   *          it. Slots are reused once their element is removed
+   *          from the world but their generation is incremented
+   *          so that handles referring to the old element can be
+   *          detected as stale.
+   *          A default constructed handle is invalid.
+   */
+  template <typename T>
+  class Handle {
+    public:
+
+      /**
+       * @brief - Create an invalid handle.
+       */
+      Handle() noexcept;
+
+      /**
+       * @brief - Create a handle to the specified slot.
+       * @param index - the index of the slot.
+       * @param generation - the generation of the slot.
+       */
+      Handle(std::uint32_t index, std::uint32_t generation) noexcept;
+
+      /**
+       * @brief - Whether this handle was assigned to an element.
+       *          Note that the element might have been removed
+       *          since then.
+       * @return - `true` if the handle is valid.
+       */
+      bool
+      valid() const noexcept;
+
+      std::uint32_t
+      index() const noexcept;
+
+      std::uint32_t
+      generation() const noexcept;
+
+      bool
+      operator==(const Handle<T>& rhs) const noexcept = default;
+
+    private:
+
+      /**
+       * @brief - The index of the slot of the element.
+       */
+      std::uint32_t m_index;
+
+      /**
+       * @brief - The generation of the slot when the element was
+       *          put in it. Generations start at `1` so that a
+       *          value of `0` indicates an invalid handle.
+       */
+      std::uint32_t m_generation;
+  };
+
+  using BlockHandle = Handle<Block>;
+  using EntityHandle = Handle<Entity>;
+  using VFXHandle = Handle<VFX>;
+
+  /**
+   * @brief - Associate handles to the elements of a given type so
+   *          that they can be retrieved in constant time. The table
+   *          keeps a reference to each element until it is released
+   *          so that resolving a handle which is not stale always
+   *          yields a valid element.
+   *          The slots are reused in a deterministic order.
+   */
+  template <typename T>
+  class HandleTable {
+    public:
+
+      /**
+       * @brief - Create an empty table.
+       */
+      HandleTable() noexcept;
+
+      /**
+       * @brief - Put the element in a free slot of the table and
+       *          assign it the corresponding handle.
+       * @param element - the element to register.
+       * @return - the handle of the element.
+       */
+      Handle<T>
+      acquire(std::shared_ptr<T> element);
+
+      /**
+       * @brief - Release the slot referred to by the handle: any
+       *          handle to it becomes stale. Nothing happens if the
+       *          handle is already stale.
+       * @param handle - the handle to release.
+       */
+      void
+      release(const Handle<T>& handle) noexcept;
+
+      /**
+       * @brief - Retrieve the element referred to by the handle.
+       * @param handle - the handle to resolve.
+       * @return - the element or `null` if the handle is invalid
+       *           or stale.
+       */
+      T*
+      resolve(const Handle<T>& handle) const noexcept;
+
+      /**
+       * @brief - Similar to `resolve` but returns a shared pointer
+       *          on the element. It is meant for the rare cases
+       *          where the element should be kept alive.
+       * @param handle - the handle to resolve.
+       * @return - the element or `null` if the handle is invalid
+       *           or stale.
+       */
+      std::shared_ptr<T>
+      share(const Handle<T>& handle) const noexcept;
+
+    private:
+
+      /**
+       * @brief - Convenience structure describing a slot of the
+       *          table.
+       */
+      struct Slot {
+        std::shared_ptr<T> element;
+        std::uint32_t generation;
+      };
+
+      /**
+       * @brief - The slots of the table.
+       */
+      std::vector<Slot> m_slots;
+
+      /**
+       * @brief - The indices of the slots which are free.
+       */
+      std::vector<std::uint32_t> m_free;
+  };
+
+}
+
+# include "Handle.hxx"
+
+#endif    /* HANDLE_HH */
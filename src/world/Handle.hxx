@@ -0,0 +1,126 @@
+#ifndef    HANDLE_HXX
+# define   HANDLE_HXX
+
+# include "Handle.hh"
+
+namespace new_frontiers {
+
+  template <typename T>
+  inline
+  Handle<T>::Handle() noexcept:
+    m_index(0u),
+    m_generation(0u)
+  {}
+
+  template <typename T>
+  inline
+  Handle<T>::Handle(std::uint32_t index, std::uint32_t generation) noexcept:
+    m_index(index),
+    m_generation(generation)
+  {}
+
+  template <typename T>
+  inline
+  bool
+  Handle<T>::valid() const noexcept {
+    return m_generation != 0u;
+  }
+
+  template <typename T>
+  inline
+  std::uint32_t
+  Handle<T>::index() const noexcept {
+    return m_index;
+  }
+
+  template <typename T>
+  inline
+  std::uint32_t
+  Handle<T>::generation() const noexcept {
+    return m_generation;
+  }
+
+  template <typename T>
+  inline
+  HandleTable<T>::HandleTable() noexcept:
+    m_slots(),
+    m_free()
+  {}
+
+  template <typename T>
+  inline
+  Handle<T>
+  HandleTable<T>::acquire(std::shared_ptr<T> element) {
+    std::uint32_t index = 0u;
+
+    if (!m_free.empty()) {
+      index = m_free.back();
+      m_free.pop_back();
+    }
+    else {
+      index = m_slots.size();
+      m_slots.push_back(Slot{nullptr, 0u});
+
+      // Make room for all the slots in the free list so
+      // that releasing an element never allocates.
+      m_free.reserve(m_slots.capacity());
+    }
+
+    // Skip the invalid generation in case the counter
+    // wraps around.
+    Slot& s = m_slots[index];
+    if (++s.generation == 0u) {
+      s.generation = 1u;
+    }
+
+    element->setHandle(index, s.generation);
+    s.element = std::move(element);
+
+    return Handle<T>(index, s.generation);
+  }
+
+  template <typename T>
+  inline
+  void
+  HandleTable<T>::release(const Handle<T>& handle) noexcept {
+    if (resolve(handle) == nullptr) {
+      return;
+    }
+
+    Slot& s = m_slots[handle.index()];
+    s.element->setHandle(0u, 0u);
+    s.element.reset();
+
+    m_free.push_back(handle.index());
+  }
+
+  template <typename T>
+  inline
+  T*
+  HandleTable<T>::resolve(const Handle<T>& handle) const noexcept {
+    if (handle.index() >= m_slots.size()) {
+      return nullptr;
+    }
+
+    const Slot& s = m_slots[handle.index()];
+    if (s.generation != handle.generation()) {
+      return nullptr;
+    }
+
+    return s.element.get();
+  }
+
+  template <typename T>
+  inline
+  std::shared_ptr<T>
+  HandleTable<T>::share(const Handle<T>& handle) const noexcept {
+    if (resolve(handle) == nullptr) {
+      return nullptr;
+    }
+
+    return m_slots[handle.index()].element;
+  }
+
+}
+
+#endif    /* HANDLE_HXX */
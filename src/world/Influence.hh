@@ -2,8 +2,9 @@
 # define   INFLUENCE_HH
 
 # include <memory>
-# include <core_utils/CoreObject.hh>
+# include <variant>
 # include "Element.hh"
+# include "Handle.hh"
 
 namespace new_frontiers {
 
@@ -27,15 +28,39 @@ namespace new_frontiers {
     enum class Type {
       BlockSpawn,
       BlockRemoval,
+      BlockWakeUp,
       EntitySpawn,
       EntityRemoval,
       VFXSpawn,
-      VFXRemoval
+      VFXRemoval,
+      Damage,
+      Harvest,
+      Refill
     };
 
   }
 
-  class Influence: public utils::CoreObject {
+  /**
+   * @brief - Describes a modification of the world requested by
+   *          an element while it is stepped. Influences are small
+   *          values: they only hold the type of the modification
+   *          and a reference to the element it applies to, which
+   *          is either owned (for spawns, so that the element is
+   *          kept alive until the world handles it) or a handle
+   *          (for elements already managed by the world, which
+   *          resolves them in constant time). This allows to store
+   *          them by value in a list which is reused from one step
+   *          to the next so that no allocation is needed to create
+   *          them.
+   *          Some influences also carry an amount and the mob
+   *          which produced them: they describe an exchange with
+   *          the receiver (damage dealt to an entity, resources
+   *          taken from a deposit or given to a spawner) which is
+   *          resolved once all elements have been stepped.
+   *          Handles which became stale when the influence is
+   *          processed are ignored by the world.
+   */
+  class Influence {
     public:
 
       /**
@@ -45,7 +70,7 @@ namespace new_frontiers {
        *                apply.
        */
       Influence(const influence::Type& type,
-                Block* block);
+                BlockHandle block) noexcept;
 
       /**
        * @brief - Create a new influence with the specified type.
@@ -54,7 +79,7 @@ namespace new_frontiers {
        *                apply.
        */
       Influence(const influence::Type& type,
-                BlockShPtr block);
+                BlockShPtr block) noexcept;
 
       /**
        * @brief - Create a new influence with the specified type.
@@ -63,7 +88,7 @@ namespace new_frontiers {
        *                 apply.
        */
       Influence(const influence::Type& type,
-                Entity* entity);
+                EntityHandle entity) noexcept;
 
       /**
        * @brief - Create a new influence with the specified type.
@@ -72,7 +97,7 @@ namespace new_frontiers {
        *                 apply.
        */
       Influence(const influence::Type& type,
-                EntityShPtr entity);
+                EntityShPtr entity) noexcept;
 
       /**
        * @brief - Create a new influence with the specified type.
@@ -80,7 +105,7 @@ namespace new_frontiers {
        * @param vfx - the vfx onto which the influence will apply.
        */
       Influence(const influence::Type& type,
-                VFX* vfx);
+                VFXHandle vfx) noexcept;
 
       /**
        * @brief - Create a new influence with the specified type.
@@ -88,31 +113,53 @@ namespace new_frontiers {
        * @param vfx - the vfx onto which the influence will apply.
        */
       Influence(const influence::Type& type,
-                VFXShPtr vfx);
+                VFXShPtr vfx) noexcept;
 
-      ~Influence() = default;
+      /**
+       * @brief - Create a new damage influence.
+       * @param entity - the entity to hit.
+       * @param hit - the amount of damage to deal.
+       */
+      Influence(EntityHandle entity,
+                float hit) noexcept;
+
+      /**
+       * @brief - Create a new exchange of resources with a block:
+       *          either a harvest, requesting some resources from
+       *          a deposit, or a refill, adding resources to a
+       *          spawner (if the amount is positive) or taking some
+       *          from it to heal a mob (if it is negative).
+       * @param type - the type of the exchange.
+       * @param block - the deposit or spawner.
+       * @param mob - the mob carrying the resources or to heal.
+       *              It can be invalid when adding resources.
+       * @param amount - the amount of resources exchanged.
+       */
+      Influence(const influence::Type& type,
+                BlockHandle block,
+                EntityHandle mob,
+                float amount) noexcept;
 
       const influence::Type&
       getType() const noexcept;
 
       /**
-       * @brief - Return the block associated to this influence
-       *          in case it is not `null`. If it is an error
-       *          is raised.
-       * @return - the pointer to the block associated to this
+       * @brief - Return the block associated to this influence.
+       *          Raises an error in case the influence was not
+       *          created with a block handle.
+       * @return - the handle to the block associated to this
        *           influence.
        */
-      Block*
+      BlockHandle
       getBlock() const;
 
       /**
        * @brief - Similar to the `getBlock` method but returns
-       *          the shared pointer on a block. Also raised an
-       *          error in case this value is `null`.
+       *          the shared pointer on a block.
        * @return - the pointer to the block associated to this
        *           influence.
        */
-      BlockShPtr
+      const BlockShPtr&
       getShPBlock() const;
 
       /**
@@ -120,7 +167,7 @@ namespace new_frontiers {
        *          is linked this influence.
        * @return - the entity associated to this influence.
        */
-      Entity*
+      EntityHandle
       getEntity() const;
 
       /**
@@ -128,7 +175,7 @@ namespace new_frontiers {
        *          is linked this influence.
        * @return - the entity associated to this influence.
        **/
-      EntityShPtr
+      const EntityShPtr&
       getShPEntity() const;
 
       /**
@@ -136,7 +183,7 @@ namespace new_frontiers {
        *          is linked this influence.
        * @return - the vfx associated to this influence.
        */
-      VFX*
+      VFXHandle
       getVFX() const;
 
       /**
@@ -144,57 +191,64 @@ namespace new_frontiers {
        *          is linked this influence.
        * @return - the vfx associated to this influence.
        **/
-      VFXShPtr
+      const VFXShPtr&
       getShPVFX() const;
 
-    private:
-
       /**
-       * @brief - The type of the influence. Allows to determine
-       *          how the related block should be interpreted.
+       * @brief - The mob which produced this influence, if any.
+       * @return - the mob or an invalid handle if none is attached.
        */
-      influence::Type m_type;
+      EntityHandle
+      getMob() const noexcept;
 
       /**
-       * @brief - One possible receiver of the influence. It is
-       *          only used if the type refers to an action of
-       *          deleting a block. This allows the block to
-       *          mark itself for deletion without duplicating
-       *          memory management through a shared pointer.
+       * @brief - The amount associated to this influence. It is only
+       *          relevant for damage, harvest and refill influences.
+       * @return - the amount associated to this influence.
        */
-      Block* m_block;
+      float
+      getAmount() const noexcept;
+
+    private:
 
       /**
-       * @brief - Similar to the `m_block` but used in case of
-       *          a creation influence. This ensures that the
-       *          memory is still safely managed even if this
-       *          block is not yet handled by the `World`.
+       * @brief - The possible receivers of an influence: handles
+       *          are used to refer to elements already managed by
+       *          the world while shared pointers keep new elements
+       *          alive until they are registered.
        */
-      BlockShPtr m_shPBlock;
+      using Receiver = std::variant<
+        BlockHandle,
+        EntityHandle,
+        VFXHandle,
+        BlockShPtr,
+        EntityShPtr,
+        VFXShPtr
+      >;
 
       /**
-       * @brief - Similar to the `m_block` but receives an entity
-       *          pointer to apply the influence.
+       * @brief - The type of the influence. Allows to determine
+       *          how the receiver should be interpreted.
        */
-      Entity* m_entity;
+      influence::Type m_type;
 
       /**
-       * @brief - Used in a similar way to `m_shPBlock`.
+       * @brief - The element onto which the influence applies.
        */
-      EntityShPtr m_shPEntity;
+      Receiver m_receiver;
 
       /**
-       * @brief - Similar to the `m_block` but for a VFX.
+       * @brief - The mob which produced the influence in case it
+       *          should get the result of an exchange.
        */
-      VFX* m_vfx;
+      EntityHandle m_mob;
 
       /**
-       * @brief - Used in a similar way to `m_shPBlock`.
+       * @brief - The amount of the exchange.
        */
-      VFXShPtr m_shPVFX;
+      float m_amount;
   };
 
-  using InfluenceShPtr = std::shared_ptr<Influence>;
 }
 
 # include "Influence.hxx"
@@ -7,141 +7,84 @@ namespace new_frontiers {
 
   inline
   Influence::Influence(const influence::Type& type,
-                       Block* block):
-    utils::CoreObject("influence"),
-
+                       BlockHandle block) noexcept:
     m_type(type),
+    m_receiver(block),
 
-    m_block(block),
-    m_shPBlock(nullptr),
-    m_entity(nullptr),
-    m_shPEntity(nullptr),
-    m_vfx(nullptr),
-    m_shPVFX(nullptr)
-  {
-    // Make sure there's an element.
-    if (m_block == nullptr) {
-      error(
-        std::string("Could not create influence"),
-        std::string("Invalid null block receiver object")
-      );
-    }
-  }
+    m_mob(),
+    m_amount(0.0f)
+  {}
 
   inline
   Influence::Influence(const influence::Type& type,
-                       BlockShPtr block):
-    utils::CoreObject("influence"),
-
+                       BlockShPtr block) noexcept:
     m_type(type),
+    m_receiver(std::move(block)),
 
-    m_block(nullptr),
-    m_shPBlock(block),
-    m_entity(nullptr),
-    m_shPEntity(nullptr),
-    m_vfx(nullptr),
-    m_shPVFX(nullptr)
-  {
-    // Make sure there's an element.
-    if (m_shPBlock == nullptr) {
-      error(
-        std::string("Could not create influence"),
-        std::string("Invalid null block receiver object")
-      );
-    }
-  }
+    m_mob(),
+    m_amount(0.0f)
+  {}
 
   inline
   Influence::Influence(const influence::Type& type,
-                       Entity* entity):
-    utils::CoreObject("influence"),
-
+                       EntityHandle entity) noexcept:
     m_type(type),
+    m_receiver(entity),
 
-    m_block(nullptr),
-    m_shPBlock(nullptr),
-    m_entity(entity),
-    m_shPEntity(nullptr),
-    m_vfx(nullptr),
-    m_shPVFX(nullptr)
-  {
-    // Make sure there's an element.
-    if (m_entity == nullptr) {
-      error(
-        std::string("Could not create influence"),
-        std::string("Invalid null entity receiver object")
-      );
-    }
-  }
+    m_mob(),
+    m_amount(0.0f)
+  {}
 
   inline
   Influence::Influence(const influence::Type& type,
-                       EntityShPtr entity):
-    utils::CoreObject("influence"),
-
+                       EntityShPtr entity) noexcept:
     m_type(type),
+    m_receiver(std::move(entity)),
 
-    m_block(nullptr),
-    m_shPBlock(nullptr),
-    m_entity(nullptr),
-    m_shPEntity(entity),
-    m_vfx(nullptr),
-    m_shPVFX(nullptr)
-  {
-    // Make sure there's an element.
-    if (m_shPEntity == nullptr) {
-      error(
-        std::string("Could not create influence"),
-        std::string("Invalid null entity receiver object")
-      );
-    }
-  }
+    m_mob(),
+    m_amount(0.0f)
+  {}
 
   inline
   Influence::Influence(const influence::Type& type,
-                       VFX* vfx):
-    utils::CoreObject("influence"),
-
+                       VFXHandle vfx) noexcept:
     m_type(type),
+    m_receiver(vfx),
 
-    m_block(nullptr),
-    m_shPBlock(nullptr),
-    m_entity(nullptr),
-    m_shPEntity(nullptr),
-    m_vfx(vfx),
-    m_shPVFX(nullptr)
-  {
-    // Make sure there's an element.
-    if (m_vfx == nullptr) {
-      error(
-        std::string("Could not create influence"),
-        std::string("Invalid null vfx receiver object")
-      );
-    }
-  }
+    m_mob(),
+    m_amount(0.0f)
+  {}
 
   inline
   Influence::Influence(const influence::Type& type,
-                       VFXShPtr vfx):
-    utils::CoreObject("influence"),
-
+                       VFXShPtr vfx) noexcept:
     m_type(type),
+    m_receiver(std::move(vfx)),
 
-    m_block(nullptr),
-    m_shPBlock(nullptr),
-    m_entity(nullptr),
-    m_shPEntity(nullptr),
-    m_vfx(nullptr),
-    m_shPVFX(vfx)
-  {
-    // Make sure there's an element.
-    if (m_shPVFX == nullptr) {
-      error(
-        std::string("Could not create influence"),
-        std::string("Invalid null vfx receiver object")
-      );
-    }
-  }
+    m_mob(),
+    m_amount(0.0f)
+  {}
+
+  inline
+  Influence::Influence(EntityHandle entity,
+                       float hit) noexcept:
+    m_type(influence::Type::Damage),
+    m_receiver(entity),
+
+    m_mob(),
+    m_amount(hit)
+  {}
+
+  inline
+  Influence::Influence(const influence::Type& type,
+                       BlockHandle block,
+                       EntityHandle mob,
+                       float amount) noexcept:
+    m_type(type),
+    m_receiver(block),
+    m_mob(mob),
+    m_amount(amount)
+  {}
 
   inline
   const influence::Type&
@@ -150,81 +93,51 @@ namespace new_frontiers {
   }
 
   inline
-  Block*
+  BlockHandle
   Influence::getBlock() const {
-    if (m_block == nullptr) {
-      error(
-        std::string("Cannot retrieve block for influence"),
-        std::string("No block associated to influence")
-      );
-    }
-
-    return m_block;
+    return std::get<BlockHandle>(m_receiver);
   }
 
   inline
-  BlockShPtr
+  const BlockShPtr&
   Influence::getShPBlock() const {
-    if (m_shPBlock == nullptr) {
-      error(
-        std::string("Cannot retrieve block for influence"),
-        std::string("No block associated to influence")
-      );
-    }
-
-    return m_shPBlock;
+    return std::get<BlockShPtr>(m_receiver);
   }
 
   inline
-  Entity*
+  EntityHandle
   Influence::getEntity() const {
-    if (m_entity == nullptr) {
-      error(
-        std::string("Cannot retrieve entity for influence"),
-        std::string("No entity associated to influence")
-      );
-    }
-
-    return m_entity;
+    return std::get<EntityHandle>(m_receiver);
   }
 
   inline
-  EntityShPtr
+  const EntityShPtr&
   Influence::getShPEntity() const {
-    if (m_shPEntity == nullptr) {
-      error(
-        std::string("Cannot retrieve entity for influence"),
-        std::string("No entity associated to influence")
-      );
-    }
-
-    return m_shPEntity;
+    return std::get<EntityShPtr>(m_receiver);
   }
 
   inline
-  VFX*
+  VFXHandle
   Influence::getVFX() const {
-    if (m_vfx == nullptr) {
-      error(
-        std::string("Cannot retrieve vfx for influence"),
-        std::string("No vfx associated to influence")
-      );
-    }
-
-    return m_vfx;
+    return std::get<VFXHandle>(m_receiver);
   }
 
   inline
-  VFXShPtr
+  const VFXShPtr&
   Influence::getShPVFX() const {
-    if (m_shPVFX == nullptr) {
-      error(
-        std::string("Cannot retrieve vfx for influence"),
-        std::string("No vfx associated to influence")
-      );
-    }
-
-    return m_shPVFX;
+    return std::get<VFXShPtr>(m_receiver);
+  }
+
+  inline
+  EntityHandle
+  Influence::getMob() const noexcept {
+    return m_mob;
+  }
+
+  inline
+  float
+  Influence::getAmount() const noexcept {
+    return m_amount;
   }
 
 }
@@ -1,6 +1,8 @@
 
 # include "Locator.hxx"
 # include <maths_utils/LocationUtils.hh>
+# include "Trace.hh"
+# include "Logging.hh"
 
 namespace new_frontiers {
 
@@ -9,7 +11,11 @@ namespace new_frontiers {
                    const std::vector<BlockShPtr>& blocks,
                    const std::vector<EntityShPtr>& entities,
                    const std::vector<VFXShPtr>& vfxs,
-                   const std::vector<ColonyShPtr>& colonies):
+                   const std::vector<ColonyShPtr>& colonies,
+                   const HandleTable<Block>& blockHandles,
+                   const HandleTable<Entity>& entityHandles,
+                   const HandleTable<VFX>& vfxHandles,
+                   const Components& components):
     utils::CoreObject("locator"),
 
     m_w(width),
@@ -20,6 +26,12 @@ namespace new_frontiers {
     m_vfxs(vfxs),
     m_colonies(colonies),
 
+    m_blockHandles(blockHandles),
+    m_entityHandles(entityHandles),
+    m_vfxHandles(vfxHandles),
+
+    m_components(components),
+
     m_blocksIDs()
   {
     setService("world");
@@ -32,11 +44,13 @@ namespace new_frontiers {
                       float xDir,
                       float yDir,
                       float d,
-                      std::vector<utils::Point2f>& cPoints,
+                      std::pmr::vector<utils::Point2f>& cPoints,
                       utils::Point2f* obs,
                       float sample,
                       bool allowLog) const noexcept
   {
+    TRACE_NAMED_ZONE(zone, "locator::obstructed");
+
     // We basically need to find which cells are 'under' the
     // line when it spans its path so as to determine whether
     // there is some solid tile along the way.
@@ -74,7 +88,7 @@ namespace new_frontiers {
     int xi, yi;
 
     if (allowLog) {
-      verbose(
+      NF_VERBOSE(
         "Start: " + std::to_string(p.x()) + "x" + std::to_string(p.y()) +
         ", end: " + std::to_string(end.x()) + "x" + std::to_string(end.y()) +
         ", l: " + std::to_string(d) +
@@ -98,7 +112,7 @@ namespace new_frontiers {
       obstruction = (xi != xo || yi != yo) && (m_blocksIDs.count(yi * m_w + xi) > 0);
 
       if (allowLog) {
-        verbose(
+        NF_VERBOSE(
           "Considering " + std::to_string(p.x()) + "x" + std::to_string(p.y()) +
           " which " + (obstruction ? "is" : "is not") +
           " obstructed (" + std::to_string(t) + ", " + std::to_string(100.0f * t) +
@@ -122,7 +136,7 @@ namespace new_frontiers {
       }
 
       if (allowLog) {
-        verbose(
+        NF_VERBOSE(
           "Found obstruction at " + std::to_string(p.x()) + "x" + std::to_string(p.y()) +
           " (" + std::to_string(t) + ", " + std::to_string(100.0f * t) +
           "%, d: " + std::to_string(d) + ")"
@@ -146,7 +160,7 @@ namespace new_frontiers {
     }
 
     if (allowLog) {
-      verbose(
+      NF_VERBOSE(
         std::string("") + (obstruction ? "Found" : "Didn't find") +
         " obstruction 2 at " +
         std::to_string(end.x()) + "x" + std::to_string(end.y()) +
@@ -155,6 +169,9 @@ namespace new_frontiers {
       );
     }
 
+    TRACE_ARG(zone, "cells", cPoints.size());
+    TRACE_ARG(zone, "obstructed", obstruction);
+
     return obstruction;
   }
 
@@ -167,6 +184,8 @@ namespace new_frontiers {
                       const world::Filter* filter,
                       world::Sort sort) const noexcept
   {
+    TRACE_NAMED_ZONE(zone, "locator::getVisible");
+
     std::vector<world::ItemEntry> out;
     std::vector<SortEntry> entries;
 
@@ -189,11 +208,11 @@ namespace new_frontiers {
         //    and the item's one is different.
         //  - the filter says to exclude the specified id
         //    and the item's one is identical.
-        const utils::Uuid& uuid = m_blocks[id]->getOwner();
+        OwnerId o = m_blocks[id]->getOwner();
         if (filter != nullptr &&
             (
-              (filter->include && uuid != filter->id) ||
-              (!filter->include && uuid == filter->id)
+              (filter->include && o != filter->id) ||
+              (!filter->include && o == filter->id)
             )
            )
         {
@@ -209,20 +228,21 @@ namespace new_frontiers {
     // Then entities.
     if (type == nullptr || *type == world::ItemType::Entity) {
       ie.type = world::ItemType::Entity;
+      bool attached = entitiesAttached();
 
       for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
-        const EntityTile& t = m_entities[id]->getTile();
+        const utils::Point2f& ep = entityPosition(id, attached);
 
-        if (t.p.x() < xMin || t.p.x() > xMax || t.p.y() < yMin || t.p.y() > yMax) {
+        if (ep.x() < xMin || ep.x() > xMax || ep.y() < yMin || ep.y() > yMax) {
           continue;
         }
 
         // See above for details.
-        const utils::Uuid& uuid = m_entities[id]->getOwner();
+        OwnerId o = entityOwner(id, attached);
         if (filter != nullptr &&
             (
-              (filter->include && uuid != filter->id) ||
-              (!filter->include && uuid == filter->id)
+              (filter->include && o != filter->id) ||
+              (!filter->include && o == filter->id)
             )
            )
         {
@@ -230,7 +250,7 @@ namespace new_frontiers {
         }
 
         ie.index = id;
-        entries.push_back(SortEntry{t.p, static_cast<unsigned>(out.size())});
+        entries.push_back(SortEntry{ep, static_cast<unsigned>(out.size())});
         out.push_back(ie);
       }
     }
@@ -247,11 +267,11 @@ namespace new_frontiers {
         }
 
         // See above for details.
-        const utils::Uuid& uuid = m_vfxs[id]->getOwner();
+        OwnerId o = m_vfxs[id]->getOwner();
         if (filter != nullptr &&
             (
-              (filter->include && uuid != filter->id) ||
-              (!filter->include && uuid == filter->id)
+              (filter->include && o != filter->id) ||
+              (!filter->include && o == filter->id)
             )
            )
         {
@@ -288,18 +308,23 @@ namespace new_frontiers {
       }
     }
 
+    TRACE_ARG(zone, "count", out.size());
+
     return out;
   }
 
-  std::vector<world::ItemEntry>
+  std::pmr::vector<world::ItemEntry>
   Locator::getVisible(const utils::Point2f& p,
                       float r,
                       const world::ItemType* type,
                       const world::Filter* filter,
-                      world::Sort sort) const noexcept
+                      world::Sort sort,
+                      std::pmr::memory_resource* arena) const noexcept
   {
-    std::vector<world::ItemEntry> out;
-    std::vector<SortEntry> entries;
+    TRACE_NAMED_ZONE(zone, "locator::getVisible");
+
+    std::pmr::vector<world::ItemEntry> out(arena);
+    std::pmr::vector<SortEntry> entries(arena);
 
     world::ItemEntry ie;
     float r2 = r * r;
@@ -321,11 +346,11 @@ namespace new_frontiers {
         //    and the item's one is different.
         //  - the filter says to exclude the specified id
         //    and the item's one is identical.
-        const utils::Uuid& uuid = m_blocks[id]->getOwner();
+        OwnerId o = m_blocks[id]->getOwner();
         if (filter != nullptr &&
             (
-              (filter->include && uuid != filter->id) ||
-              (!filter->include && uuid == filter->id)
+              (filter->include && o != filter->id) ||
+              (!filter->include && o == filter->id)
             )
            )
         {
@@ -341,20 +366,21 @@ namespace new_frontiers {
     // Then entities.
     if (type == nullptr || *type == world::ItemType::Entity) {
       ie.type = world::ItemType::Entity;
+      bool attached = entitiesAttached();
 
       for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
-        const EntityTile& t = m_entities[id]->getTile();
+        const utils::Point2f& ep = entityPosition(id, attached);
 
-        if (r > 0.0f && utils::d2(t.p.x(), t.p.y(), p.x(), p.y()) > r2) {
+        if (r > 0.0f && utils::d2(ep.x(), ep.y(), p.x(), p.y()) > r2) {
           continue;
         }
 
         // See above for details.
-        const utils::Uuid& uuid = m_entities[id]->getOwner();
+        OwnerId o = entityOwner(id, attached);
         if (filter != nullptr &&
             (
-              (filter->include && uuid != filter->id) ||
-              (!filter->include && uuid == filter->id)
+              (filter->include && o != filter->id) ||
+              (!filter->include && o == filter->id)
             )
            )
         {
@@ -362,7 +388,7 @@ namespace new_frontiers {
         }
 
         ie.index = id;
-        entries.push_back(SortEntry{t.p, static_cast<unsigned>(out.size())});
+        entries.push_back(SortEntry{ep, static_cast<unsigned>(out.size())});
         out.push_back(ie);
       }
     }
@@ -379,11 +405,11 @@ namespace new_frontiers {
         }
 
         // See above for details.
-        const utils::Uuid& uuid = m_vfxs[id]->getOwner();
+        OwnerId o = m_vfxs[id]->getOwner();
         if (filter != nullptr &&
             (
-              (filter->include && uuid != filter->id) ||
-              (!filter->include && uuid == filter->id)
+              (filter->include && o != filter->id) ||
+              (!filter->include && o == filter->id)
             )
            )
         {
@@ -416,17 +442,54 @@ namespace new_frontiers {
 
       // Reorder the output vector based on the
       // result of the sort.
-      std::vector<world::ItemEntry> sorted;
+      std::pmr::vector<world::ItemEntry> sorted(arena);
       sorted.swap(out);
+      out.reserve(sorted.size());
 
       for (unsigned id = 0u ; id < entries.size() ; ++id) {
         out.push_back(sorted[entries[id].id]);
       }
     }
 
+    TRACE_ARG(zone, "count", out.size());
+
     return out;
   }
 
+  unsigned
+  Locator::countEntities(const utils::Point2f& p,
+                         float r,
+                         const world::Filter* filter) const noexcept
+  {
+    unsigned count = 0u;
+    float r2 = r * r;
+    bool attached = entitiesAttached();
+
+    for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
+      const utils::Point2f& ep = entityPosition(id, attached);
+
+      if (r > 0.0f && utils::d2(ep.x(), ep.y(), p.x(), p.y()) > r2) {
+        continue;
+      }
+
+      // See `getVisible` for details.
+      OwnerId o = entityOwner(id, attached);
+      if (filter != nullptr &&
+          (
+            (filter->include && o != filter->id) ||
+            (!filter->include && o == filter->id)
+          )
+         )
+      {
+        continue;
+      }
+
+      ++count;
+    }
+
+    return count;
+  }
+
   void
   Locator::initialize() {
     // Register each solid tile in the map.
@@ -2,12 +2,14 @@
 # define   LOCATOR_HH
 
 # include <memory>
+# include <memory_resource>
 # include <unordered_set>
 # include <core_utils/CoreObject.hh>
 # include "blocks/Block.hh"
 # include "entities/Entity.hh"
 # include "effects/VFX.hh"
 # include "colonies/Colony.hh"
+# include "Handle.hh"
 
 namespace new_frontiers {
 
@@ -28,7 +30,7 @@ namespace new_frontiers {
      *          elements based on their visibility.
      */
     struct Filter {
-      utils::Uuid id;
+      OwnerId id;
       bool include;
     };
 
@@ -40,7 +42,7 @@ namespace new_frontiers {
       BlockTile tile;
       float health;
       float ratio;
-      utils::Uuid owner;
+      OwnerId owner;
     };
 
     /**
@@ -59,6 +61,7 @@ namespace new_frontiers {
       float cargo;
       State state;
       path::Path path;
+      OwnerId owner;
     };
 
     /**
@@ -72,6 +75,7 @@ namespace new_frontiers {
       VFXTile tile;
       float radius;
       float amount;
+      OwnerId owner;
     };
 
     /**
@@ -79,7 +83,7 @@ namespace new_frontiers {
      *          about a colony.
      */
     struct Colony {
-      utils::Uuid id;
+      OwnerId id;
       colony::Priority focus;
       float ratio;
 
@@ -154,13 +158,23 @@ namespace new_frontiers {
        * @param colonies - the list of colonies registered in
        *                   this world.
        * @param vfxs - the list of visual effects of the world.
+       * @param blockHandles - the table of handles of the blocks.
+       * @param entityHandles - the table of handles of entities.
+       * @param vfxHandles - the table of handles of the effects.
+       * @param components - the components holding the position
+       *                     of the entities when they are all
+       *                     attached to them.
        */
       Locator(int width,
               int height,
               const std::vector<BlockShPtr>& blocks,
               const std::vector<EntityShPtr>& entities,
               const std::vector<VFXShPtr>& vfxs,
-              const std::vector<ColonyShPtr>& colonies);
+              const std::vector<ColonyShPtr>& colonies,
+              const HandleTable<Block>& blockHandles,
+              const HandleTable<Entity>& entityHandles,
+              const HandleTable<VFX>& vfxHandles,
+              const Components& components);
 
       /**
        * @brief - Return the width of the world in cells.
@@ -189,6 +203,31 @@ namespace new_frontiers {
       world::Block
       block(int id) const noexcept;
 
+      /**
+       * @brief - Retrieve the block referred to by the handle in
+       *          constant time.
+       * @param handle - the handle of the block.
+       * @return - the block or `null` if the handle is stale.
+       */
+      Block*
+      resolve(const BlockHandle& handle) const noexcept;
+
+      /**
+       * @brief - Similar to the above but for an entity.
+       * @param handle - the handle of the entity.
+       * @return - the entity or `null` if the handle is stale.
+       */
+      Entity*
+      resolve(const EntityHandle& handle) const noexcept;
+
+      /**
+       * @brief - Similar to the above but for an effect.
+       * @param handle - the handle of the effect.
+       * @return - the effect or `null` if the handle is stale.
+       */
+      VFX*
+      resolve(const VFXHandle& handle) const noexcept;
+
       /**
        * @brief - Similar to the `solidTile` method but to get
        *          the entity at the specified index.
@@ -206,6 +245,30 @@ namespace new_frontiers {
       world::VFX
       vfx(int id) const noexcept;
 
+      /**
+       * @brief - Return the number of blocks registered so far
+       *          in the world.
+       * @return - the number of blocks in this world.
+       */
+      int
+      blocksCount() const noexcept;
+
+      /**
+       * @brief - Return the number of entities registered so
+       *          far in the world.
+       * @return - the number of entities in this world.
+       */
+      int
+      entitiesCount() const noexcept;
+
+      /**
+       * @brief - Return the number of visual effects existing
+       *          in the world.
+       * @return - the number of vfxs in this world.
+       */
+      int
+      vfxsCount() const noexcept;
+
       /**
        * @brief - Return the number of colonies registered so
        *          far in the world.
@@ -288,7 +351,7 @@ namespace new_frontiers {
                  float xDir,
                  float yDir,
                  float d,
-                 std::vector<utils::Point2f>& cPoints,
+                 std::pmr::vector<utils::Point2f>& cPoints,
                  utils::Point2f* obs = nullptr,
                  float sample = 0.05f,
                  bool allowLog = false) const noexcept;
@@ -312,7 +375,7 @@ namespace new_frontiers {
       bool
       obstructed(utils::Point2f p,
                  utils::Point2f e,
-                 std::vector<utils::Point2f>& cPoints,
+                 std::pmr::vector<utils::Point2f>& cPoints,
                  utils::Point2f* obs = nullptr,
                  float sample = 0.05f,
                  bool allowLog = false) const noexcept;
@@ -335,7 +398,7 @@ namespace new_frontiers {
        * @param type - the type of elements to consider. If
        *               this value is set to `null` all the
        *               item types will be included.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not it should be used
        *                  and considered when fetching items.
        * @param sort - the algorithm to use when performing the
@@ -368,20 +431,24 @@ namespace new_frontiers {
        * @param type - the type of elements to consider. If
        *               this value is set to `null` all the
        *               item types will be included.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not it should be used
        *                  and considered when fetching items.
        * @param sort - the algorithm to use when performing the
        *               sorting operation (none by default).
+       * @param arena - the memory resource of the returned list and
+       *                of the temporaries: elements pass the arena of
+       *                their step.
        * @return - the list of elements corresponding in the
        *           specified area.
        */
-      std::vector<world::ItemEntry>
+      std::pmr::vector<world::ItemEntry>
       getVisible(const utils::Point2f& p,
                  float r,
                  const world::ItemType* type = nullptr,
                  const world::Filter* filter = nullptr,
-                 world::Sort sort = world::Sort::None) const noexcept;
+                 world::Sort sort = world::Sort::None,
+                 std::pmr::memory_resource* arena = std::pmr::get_default_resource()) const noexcept;
 
       /**
        * @brief - Similar to the `getVisible` method but
@@ -393,7 +460,7 @@ namespace new_frontiers {
        *            an element should be found.
        * @param type - the type of the element to search
        *               for.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not it should be used
        *                  and considered when fetching items.
        * @return - the corresponding element's description
@@ -418,20 +485,22 @@ namespace new_frontiers {
        * @param id - the variant of the block to consider.
        *             If this value is `-1` any variant is
        *             considered.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not theyit should be used
        *                  and considered when fetching items.
        * @param sort - the algorithm to use when performing the
        *               sorting operation (none by default).
-       * @return - the list of blocks.
+       * @param arena - the memory resource of the returned list.
+       * @return - the handles of the blocks.
        */
-      std::vector<BlockShPtr>
+      std::pmr::vector<BlockHandle>
       getVisible(const utils::Point2f& p,
                  float r,
                  const tiles::Block* bTile,
                  int id = -1,
                  const world::Filter* filter = nullptr,
-                 world::Sort sort = world::Sort::None) const noexcept;
+                 world::Sort sort = world::Sort::None,
+                 std::pmr::memory_resource* arena = std::pmr::get_default_resource()) const noexcept;
 
       /**
        * @brief - Specialization of the `getVisible` method
@@ -446,20 +515,22 @@ namespace new_frontiers {
        * @param id - the variant of the entity to consider.
        *             If this value is `-1` any variant is
        *             considered.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not it should be used
        *                  and considered when fetching items.
        * @param sort - the algorithm to use when performing the
        *               sorting operation (none by default).
-       * @return - the list of entities.
+       * @param arena - the memory resource of the returned list.
+       * @return - the handles of the entities.
        */
-      std::vector<EntityShPtr>
+      std::pmr::vector<EntityHandle>
       getVisible(const utils::Point2f& p,
                  float r,
                  const tiles::Entity* eTile,
                  int id = -1,
                  const world::Filter* filter = nullptr,
-                 world::Sort sort = world::Sort::None) const noexcept;
+                 world::Sort sort = world::Sort::None,
+                 std::pmr::memory_resource* arena = std::pmr::get_default_resource()) const noexcept;
 
       /**
        * @brief - Specialization of the `getVisible` method
@@ -474,20 +545,22 @@ namespace new_frontiers {
        * @param id - the variant of the VFX to consider.
        *             If this value is `-1` any variant is
        *             considered.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not it should be used
        *                  and considered when fetching items.
        * @param sort - the algorithm to use when performing the
        *               sorting operation (none by default).
-       * @return - the list of VFXs.
+       * @param arena - the memory resource of the returned list.
+       * @return - the handles of the VFXs.
        */
-      std::vector<VFXShPtr>
+      std::pmr::vector<VFXHandle>
       getVisible(const utils::Point2f& p,
                  float r,
                  const tiles::Effect* vTile,
                  int id = -1,
                  const world::Filter* filter = nullptr,
-                 world::Sort sort = world::Sort::None) const noexcept;
+                 world::Sort sort = world::Sort::None,
+                 std::pmr::memory_resource* arena = std::pmr::get_default_resource()) const noexcept;
 
       /**
        * @brief - Similar to the `getVisible` but only returns
@@ -501,17 +574,20 @@ namespace new_frontiers {
        *            considered.
        * @param id - the variant of the block to consider. If
        *             this value is `-1` any variant is considered.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not it should be used
        *                  and considered when fetching items.
-       * @return - the list of blocks.
+       * @param arena - the memory resource of the temporaries.
+       * @return - the handle of the block, invalid if none
+       *           can be found.
        */
-      BlockShPtr
+      BlockHandle
       getClosest(const utils::Point2f& p,
                  const tiles::Block& bTile,
                  float r = -1.0f,
                  int id = -1,
-                 const world::Filter* filter = nullptr) const noexcept;
+                 const world::Filter* filter = nullptr,
+                 std::pmr::memory_resource* arena = std::pmr::get_default_resource()) const noexcept;
 
       /**
        * @brief - Similar to the `getVisible` but only returns
@@ -525,17 +601,38 @@ namespace new_frontiers {
        *            considered.
        * @param id - the variant of the entity to consider. If
        *             this value is `-1` any variant is considered.
-       * @param filters - include a description of a uuid and
+       * @param filters - include a description of an owner and
        *                  whether or not it should be used
        *                  and considered when fetching items.
-       * @return - the list of entities.
+       * @param arena - the memory resource of the temporaries.
+       * @return - the handle of the entity, invalid if none
+       *           can be found.
        */
-      EntityShPtr
+      EntityHandle
       getClosest(const utils::Point2f& p,
                  const tiles::Entity& eTile,
                  float r = -1.0f,
                  int id = -1,
-                 const world::Filter* filter = nullptr) const noexcept;
+                 const world::Filter* filter = nullptr,
+                 std::pmr::memory_resource* arena = std::pmr::get_default_resource()) const noexcept;
+
+      /**
+       * @brief - Count the entities in a certain area without
+       *          building the list of their handles: this does
+       *          not allocate and can be used to check whether
+       *          some entities are close to a position.
+       * @param p - the position of the center of the area to
+       *            consider.
+       * @param r - the radius of the area to consider.
+       * @param filters - include a description of an owner and
+       *                  whether or not it should be used
+       *                  and considered when counting items.
+       * @return - the number of entities in the area.
+       */
+      unsigned
+      countEntities(const utils::Point2f& p,
+                    float r,
+                    const world::Filter* filter = nullptr) const noexcept;
 
     private:
 
@@ -547,6 +644,36 @@ namespace new_frontiers {
       void
       initialize();
 
+      /**
+       * @brief - Whether the position and owner of entities can
+       *          be read from the components: it is the case when
+       *          all entities are attached to them, in which case
+       *          their slots match their index.
+       * @return - `true` if the components hold the entities.
+       */
+      bool
+      entitiesAttached() const noexcept;
+
+      /**
+       * @brief - The position of the entity at the index, read
+       *          from the components when possible.
+       * @param id - the index of the entity.
+       * @param attached - the result of `entitiesAttached`.
+       * @return - the position of the entity.
+       */
+      const utils::Point2f&
+      entityPosition(unsigned id, bool attached) const noexcept;
+
+      /**
+       * @brief - The owner of the entity at the index, read from
+       *          the components when possible.
+       * @param id - the index of the entity.
+       * @param attached - the result of `entitiesAttached`.
+       * @return - the owner of the entity.
+       */
+      OwnerId
+      entityOwner(unsigned id, bool attached) const noexcept;
+
     private:
 
       /**
@@ -580,6 +707,20 @@ namespace new_frontiers {
        */
       const std::vector<ColonyShPtr>& m_colonies;
 
+      /**
+       * @brief - The tables used to resolve the handles of the
+       *          elements of the world.
+       */
+      const HandleTable<Block>& m_blockHandles;
+      const HandleTable<Entity>& m_entityHandles;
+      const HandleTable<VFX>& m_vfxHandles;
+
+      /**
+       * @brief - The components holding the state of entities
+       *          when component storage is enabled.
+       */
+      const Components& m_components;
+
       /**
        * @brief - A map referencing the unique indices for
        *          blocks in the world. It is build as the
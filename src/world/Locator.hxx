@@ -42,7 +42,7 @@ namespace new_frontiers {
   inline
   world::Block
   Locator::block(int id) const noexcept {
-    BlockShPtr b = m_blocks[id];
+    Block* b = m_blocks[id].get();
 
     world::Block bd{
       b->getTile(),
@@ -51,7 +51,7 @@ namespace new_frontiers {
       b->getOwner()
     };
 
-    SpawnerOMeterShPtr som = std::dynamic_pointer_cast<SpawnerOMeter>(b);
+    SpawnerOMeter* som = dynamic_cast<SpawnerOMeter*>(b);
     if (som != nullptr) {
       bd.ratio = som->getCompletion();
     }
@@ -62,7 +62,7 @@ namespace new_frontiers {
   inline
   world::Entity
   Locator::entity(int id) const noexcept {
-    EntityShPtr e = m_entities[id];
+    Entity* e = m_entities[id].get();
 
     world::Entity ed{
       e->getTile(),
@@ -72,10 +72,15 @@ namespace new_frontiers {
       0.0f,
       0.0f,
       e->getState(),
-      e->getPath()
+      e->getPath(),
+      e->getOwner()
     };
 
-    MobShPtr m = std::dynamic_pointer_cast<Mob>(e);
+    // The renderers read the position published in
+    // the components.
+    ed.tile.p = entityPosition(id, entitiesAttached());
+
+    Mob* m = dynamic_cast<Mob*>(e);
     if (m != nullptr) {
       ed.cargo = m->getCarryingCapacity();
       ed.carrying = m->getCarried();
@@ -87,15 +92,52 @@ namespace new_frontiers {
   inline
   world::VFX
   Locator::vfx(int id) const noexcept {
-    VFXShPtr v = m_vfxs[id];
+    VFX* v = m_vfxs[id].get();
 
     return world::VFX{
       v->getTile(),
       v->getRadius(),
-      v->getAmount()
+      v->getAmount(),
+      v->getOwner()
     };
   }
 
+  inline
+  Block*
+  Locator::resolve(const BlockHandle& handle) const noexcept {
+    return m_blockHandles.resolve(handle);
+  }
+
+  inline
+  Entity*
+  Locator::resolve(const EntityHandle& handle) const noexcept {
+    return m_entityHandles.resolve(handle);
+  }
+
+  inline
+  VFX*
+  Locator::resolve(const VFXHandle& handle) const noexcept {
+    return m_vfxHandles.resolve(handle);
+  }
+
+  inline
+  int
+  Locator::blocksCount() const noexcept {
+    return static_cast<int>(m_blocks.size());
+  }
+
+  inline
+  int
+  Locator::entitiesCount() const noexcept {
+    return static_cast<int>(m_entities.size());
+  }
+
+  inline
+  int
+  Locator::vfxsCount() const noexcept {
+    return static_cast<int>(m_vfxs.size());
+  }
+
   inline
   int
   Locator::coloniesCount() const noexcept {
@@ -144,7 +186,7 @@ namespace new_frontiers {
   bool
   Locator::obstructed(utils::Point2f p,
                       utils::Point2f e,
-                      std::vector<utils::Point2f>& cPoints,
+                      std::pmr::vector<utils::Point2f>& cPoints,
                       utils::Point2f* obs,
                       float sample,
                       bool allowLog) const noexcept
@@ -165,7 +207,7 @@ namespace new_frontiers {
                       const world::Filter& filter) const noexcept
   {
     // Use the dedicated handler.
-    std::vector<world::ItemEntry> all = getVisible(p, -1.0f, &type, &filter, world::Sort::Distance);
+    std::pmr::vector<world::ItemEntry> all = getVisible(p, -1.0f, &type, &filter, world::Sort::Distance);
 
     // Return the closest one if any has
     // been found or an invalid entry. As
@@ -179,21 +221,22 @@ namespace new_frontiers {
   }
 
   inline
-  std::vector<BlockShPtr>
+  std::pmr::vector<BlockHandle>
   Locator::getVisible(const utils::Point2f& p,
                       float r,
                       const tiles::Block* bTile,
                       int id,
                       const world::Filter* filter,
-                      world::Sort sort) const noexcept
+                      world::Sort sort,
+                      std::pmr::memory_resource* arena) const noexcept
   {
     // Fetch visible blocks descriptions.
     world::ItemType t = world::ItemType::Block;
-    std::vector<world::ItemEntry> bds = getVisible(p, r, &t, filter, sort);
+    std::pmr::vector<world::ItemEntry> bds = getVisible(p, r, &t, filter, sort, arena);
 
-    std::vector<BlockShPtr> bs;
+    std::pmr::vector<BlockHandle> bs(arena);
     for (unsigned i = 0u ; i < bds.size() ; ++i) {
-      BlockShPtr b = m_blocks[bds[i].index];
+      const Block* b = m_blocks[bds[i].index].get();
 
       // Not the same tile.
       if (bTile != nullptr && b->getTile().type != *bTile) {
@@ -206,28 +249,29 @@ namespace new_frontiers {
       }
 
       // The block should be considered.
-      bs.push_back(b);
+      bs.push_back(b->getHandle());
     }
 
     return bs;
   }
 
   inline
-  std::vector<EntityShPtr>
+  std::pmr::vector<EntityHandle>
   Locator::getVisible(const utils::Point2f& p,
                       float r,
                       const tiles::Entity* eTile,
                       int id,
                       const world::Filter* filter,
-                      world::Sort sort) const noexcept
+                      world::Sort sort,
+                      std::pmr::memory_resource* arena) const noexcept
   {
     // Fetch visible entities descriptions.
     world::ItemType t = world::ItemType::Entity;
-    std::vector<world::ItemEntry> eds = getVisible(p, r, &t, filter, sort);
+    std::pmr::vector<world::ItemEntry> eds = getVisible(p, r, &t, filter, sort, arena);
 
-    std::vector<EntityShPtr> es;
+    std::pmr::vector<EntityHandle> es(arena);
     for (unsigned i = 0u ; i < eds.size() ; ++i) {
-      EntityShPtr e = m_entities[eds[i].index];
+      const Entity* e = m_entities[eds[i].index].get();
 
       // Not the same tile.
       if (eTile != nullptr && e->getTile().type != *eTile) {
@@ -240,28 +284,29 @@ namespace new_frontiers {
       }
 
       // The entity should be considered.
-      es.push_back(e);
+      es.push_back(e->getHandle());
     }
 
     return es;
   }
 
   inline
-  std::vector<VFXShPtr>
+  std::pmr::vector<VFXHandle>
   Locator::getVisible(const utils::Point2f& p,
                       float r,
                       const tiles::Effect* vTile,
                       int id,
                       const world::Filter* filter,
-                      world::Sort sort) const noexcept
+                      world::Sort sort,
+                      std::pmr::memory_resource* arena) const noexcept
   {
     // Fetch visible entities descriptions.
     world::ItemType t = world::ItemType::VFX;
-    std::vector<world::ItemEntry> vds = getVisible(p, r, &t, filter, sort);
+    std::pmr::vector<world::ItemEntry> vds = getVisible(p, r, &t, filter, sort, arena);
 
-    std::vector<VFXShPtr> vs;
+    std::pmr::vector<VFXHandle> vs(arena);
     for (unsigned i = 0u ; i < vds.size() ; ++i) {
-      VFXShPtr v = m_vfxs[vds[i].index];
+      const VFX* v = m_vfxs[vds[i].index].get();
 
       // Not the same tile.
       if (vTile != nullptr && v->getTile().type != *vTile) {
@@ -274,46 +319,68 @@ namespace new_frontiers {
       }
 
       // The VFX should be considered.
-      vs.push_back(v);
+      vs.push_back(v->getHandle());
     }
 
     return vs;
   }
 
   inline
-  BlockShPtr
+  BlockHandle
   Locator::getClosest(const utils::Point2f& p,
                       const tiles::Block& bTile,
                       float r,
                       int id,
-                      const world::Filter* filter) const noexcept
+                      const world::Filter* filter,
+                      std::pmr::memory_resource* arena) const noexcept
   {
-    std::vector<BlockShPtr> bs = getVisible(p, r, &bTile, id, filter, world::Sort::Distance);
+    std::pmr::vector<BlockHandle> bs = getVisible(p, r, &bTile, id, filter, world::Sort::Distance, arena);
 
     if (bs.empty()) {
-      return nullptr;
+      return BlockHandle();
     }
 
     return bs.front();
   }
 
   inline
-  EntityShPtr
+  EntityHandle
   Locator::getClosest(const utils::Point2f& p,
                       const tiles::Entity& eTile,
                       float r,
                       int id,
-                      const world::Filter* filter) const noexcept
+                      const world::Filter* filter,
+                      std::pmr::memory_resource* arena) const noexcept
   {
-    std::vector<EntityShPtr> es = getVisible(p, r, &eTile, id, filter, world::Sort::Distance);
+    std::pmr::vector<EntityHandle> es = getVisible(p, r, &eTile, id, filter, world::Sort::Distance, arena);
 
     if (es.empty()) {
-      return nullptr;
+      return EntityHandle();
     }
 
     return es.front();
   }
 
+  inline
+  bool
+  Locator::entitiesAttached() const noexcept {
+    // Components only hold entities when storage is
+    // enabled, in which case all of them are.
+    return m_components.entities() == m_entities.size();
+  }
+
+  inline
+  const utils::Point2f&
+  Locator::entityPosition(unsigned id, bool attached) const noexcept {
+    return (attached ? m_components.position(id) : m_entities[id]->getTile().p);
+  }
+
+  inline
+  OwnerId
+  Locator::entityOwner(unsigned id, bool attached) const noexcept {
+    return (attached ? m_components.owner(id) : m_entities[id]->getOwner());
+  }
+
 }
 
 #endif    /* LOCATOR_HXX */
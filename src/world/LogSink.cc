@@ -0,0 +1,246 @@
+
+# include "LogSink.hh"
+# include <chrono>
+# include <cstring>
+# include <algorithm>
+
+namespace {
+
+  /**
+   * @brief - Convert a level to the label written in front of
+   *          the messages.
+   * @param level - the level to convert.
+   * @return - the label of the level.
+   */
+  const char*
+  label(new_frontiers::logging::Level level) noexcept {
+    switch (level) {
+      case new_frontiers::logging::Level::Debug:
+        return "debug";
+      case new_frontiers::logging::Level::Verbose:
+        return "verbose";
+      case new_frontiers::logging::Level::Info:
+        return "info";
+      case new_frontiers::logging::Level::Warning:
+        return "warning";
+      default:
+        return "unknown";
+    }
+  }
+
+  /**
+   * @brief - Append a string to a fixed size buffer, truncating
+   *          it if needed.
+   * @param out - the buffer.
+   * @param size - the size of the buffer.
+   * @param length - the length already used, updated.
+   * @param str - the string to append.
+   * @param count - the number of characters of the string.
+   */
+  void
+  append(char* out, unsigned size, unsigned& length, const char* str, std::size_t count) noexcept {
+    std::size_t n = std::min<std::size_t>(count, size - length);
+    std::memcpy(out + length, str, n);
+    length += n;
+  }
+
+}
+
+namespace new_frontiers {
+  namespace logging {
+
+    const unsigned AsyncSink::sk_defaultCapacity = 4096u;
+
+    const unsigned AsyncSink::sk_idleDelay = 5u;
+
+    AsyncSink::AsyncSink(std::ostream& out,
+                         unsigned capacity):
+      utils::CoreObject("sink"),
+
+      m_file(),
+      m_out(&out),
+
+      m_slots(),
+      m_mask(0u),
+
+      m_head(0u),
+      m_tail(0u),
+
+      m_dropped(0u),
+      m_reported(0u),
+
+      m_running(false),
+      m_worker()
+    {
+      setService("log");
+
+      start(capacity);
+    }
+
+    AsyncSink::AsyncSink(const std::string& file,
+                         unsigned capacity):
+      utils::CoreObject("sink"),
+
+      m_file(file.c_str(), std::ios::out | std::ios::trunc),
+      m_out(&m_file),
+
+      m_slots(),
+      m_mask(0u),
+
+      m_head(0u),
+      m_tail(0u),
+
+      m_dropped(0u),
+      m_reported(0u),
+
+      m_running(false),
+      m_worker()
+    {
+      setService("log");
+
+      if (!m_file.good()) {
+        error(
+          "Unable to create log sink",
+          "Failed to open \"" + file + "\""
+        );
+      }
+
+      start(capacity);
+    }
+
+    AsyncSink::~AsyncSink() {
+      // Report the messages suppressed by the call sites which
+      // did not reach the end of their period: the background
+      // thread drains the buffer one last time before stopping.
+      Site::flush(*this);
+
+      m_running = false;
+      if (m_worker.joinable()) {
+        m_worker.join();
+      }
+    }
+
+    bool
+    AsyncSink::push(Level level,
+                    const std::string& name,
+                    const std::string& message,
+                    const std::string& cause) noexcept
+    {
+      // Claim a position whose slot is free: in case the slot
+      // still holds a message from the previous round the
+      // buffer is full.
+      std::size_t pos = m_head.load(std::memory_order_relaxed);
+      Slot* s = nullptr;
+
+      while (s == nullptr) {
+        Slot& c = m_slots[pos & m_mask];
+        std::size_t seq = c.sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+        if (diff == 0) {
+          if (m_head.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+            s = &c;
+          }
+        }
+        else if (diff < 0) {
+          m_dropped.fetch_add(1u, std::memory_order_relaxed);
+          return false;
+        }
+        else {
+          pos = m_head.load(std::memory_order_relaxed);
+        }
+      }
+
+      // Format the message in the slot.
+      const unsigned size = sizeof(s->text);
+      const char* l = label(level);
+
+      s->length = 0u;
+      append(s->text, size, s->length, "[", 1u);
+      append(s->text, size, s->length, l, std::strlen(l));
+      append(s->text, size, s->length, "] [", 3u);
+      append(s->text, size, s->length, name.c_str(), name.size());
+      append(s->text, size, s->length, "] ", 2u);
+      append(s->text, size, s->length, message.c_str(), message.size());
+
+      if (!cause.empty()) {
+        append(s->text, size, s->length, " (", 2u);
+        append(s->text, size, s->length, cause.c_str(), cause.size());
+        append(s->text, size, s->length, ")", 1u);
+      }
+
+      // Publish the message to the background thread.
+      s->sequence.store(pos + 1u, std::memory_order_release);
+
+      return true;
+    }
+
+    void
+    AsyncSink::start(unsigned capacity) {
+      std::size_t c = 1u;
+      while (c < std::max(capacity, 2u)) {
+        c <<= 1u;
+      }
+
+      m_slots = std::make_unique<Slot[]>(c);
+      m_mask = c - 1u;
+
+      for (std::size_t id = 0u ; id < c ; ++id) {
+        m_slots[id].sequence.store(id, std::memory_order_relaxed);
+        m_slots[id].length = 0u;
+      }
+
+      m_running = true;
+      m_worker = std::thread(&AsyncSink::run, this);
+    }
+
+    void
+    AsyncSink::run() {
+      while (m_running.load(std::memory_order_relaxed)) {
+        if (!drain()) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(sk_idleDelay));
+        }
+      }
+
+      // Write the messages pushed before the sink was
+      // stopped.
+      drain();
+    }
+
+    bool
+    AsyncSink::drain() {
+      bool written = false;
+
+      while (true) {
+        Slot& s = m_slots[m_tail & m_mask];
+        if (s.sequence.load(std::memory_order_acquire) != m_tail + 1u) {
+          break;
+        }
+
+        m_out->write(s.text, s.length);
+        m_out->put('\n');
+
+        // Make the slot available for the next round.
+        s.sequence.store(m_tail + m_mask + 1u, std::memory_order_release);
+        ++m_tail;
+
+        written = true;
+      }
+
+      std::size_t dropped = m_dropped.load(std::memory_order_relaxed);
+      if (dropped != m_reported) {
+        *m_out << "[warning] [sink] Dropped " << dropped - m_reported << " message(s), buffer is full\n";
+        m_reported = dropped;
+
+        written = true;
+      }
+
+      if (written) {
+        m_out->flush();
+      }
+
+      return written;
+    }
+
+  }
+}
@@ -0,0 +1,188 @@
+#ifndef    LOG_SINK_HH
+# define   LOG_SINK_HH
+
+# include <atomic>
+# include <memory>
+# include <string>
+# include <thread>
+# include <cstddef>
+# include <fstream>
+# include <ostream>
+# include <core_utils/CoreObject.hh>
+# include "Logging.hh"
+
+namespace new_frontiers {
+  namespace logging {
+
+    /**
+     * @brief - A sink writing log messages from a background
+     *          thread. Producers format their message into a
+     *          slot of a fixed size ring buffer without taking
+     *          any lock, and the background thread drains the
+     *          buffer into the output stream. This keeps the
+     *          console I/O out of the simulation thread.
+     *          Messages pushed while the buffer is full are
+     *          dropped and their number is reported in the
+     *          output.
+     */
+    class AsyncSink: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Create a new sink writing to the specified
+         *          stream and start its background thread.
+         * @param out - the stream to write to, should outlive
+         *              the sink.
+         * @param capacity - the number of messages the buffer
+         *                   can hold, rounded up to a power of
+         *                   two.
+         */
+        explicit
+        AsyncSink(std::ostream& out,
+                  unsigned capacity = sk_defaultCapacity);
+
+        /**
+         * @brief - Create a new sink writing to the specified
+         *          file. The file is truncated.
+         * @param file - the name of the file to write.
+         * @param capacity - the number of messages the buffer
+         *                   can hold.
+         */
+        explicit
+        AsyncSink(const std::string& file,
+                  unsigned capacity = sk_defaultCapacity);
+
+        /**
+         * @brief - Stop the background thread after writing the
+         *          messages still in the buffer.
+         */
+        ~AsyncSink();
+
+        /**
+         * @brief - Format a message in a free slot of the buffer.
+         *          The message is truncated in case it does not
+         *          fit in a slot. Can be called from any thread.
+         * @param level - the level of the message.
+         * @param name - the name of the object emitting it.
+         * @param message - the message.
+         * @param cause - an optional cause, might be empty.
+         * @return - `false` if the message was dropped because
+         *           the buffer is full.
+         */
+        bool
+        push(Level level,
+             const std::string& name,
+             const std::string& message,
+             const std::string& cause) noexcept;
+
+        /**
+         * @brief - The number of messages dropped so far because
+         *          the buffer was full.
+         * @return - the number of dropped messages.
+         */
+        std::size_t
+        dropped() const noexcept;
+
+      private:
+
+        /**
+         * @brief - A slot of the buffer. The sequence tells whether
+         *          the slot is free for the producer expecting the
+         *          position or holds a message for the consumer.
+         */
+        struct Slot {
+          std::atomic_size_t sequence;
+
+          unsigned length;
+          char text[256];
+        };
+
+        /**
+         * @brief - Allocate the buffer and start the background
+         *          thread.
+         * @param capacity - the requested capacity of the buffer.
+         */
+        void
+        start(unsigned capacity);
+
+        /**
+         * @brief - The loop of the background thread: writes the
+         *          messages until the sink is stopped.
+         */
+        void
+        run();
+
+        /**
+         * @brief - Write all the messages currently available in
+         *          the buffer, along with the number of messages
+         *          dropped since the last call if any.
+         * @return - `true` if at least a message was written.
+         */
+        bool
+        drain();
+
+      private:
+
+        /**
+         * @brief - The default number of slots of the buffer.
+         */
+        static const unsigned sk_defaultCapacity;
+
+        /**
+         * @brief - The time the background thread sleeps when the
+         *          buffer is empty, in milliseconds.
+         */
+        static const unsigned sk_idleDelay;
+
+        /**
+         * @brief - The file opened by the sink if any and the
+         *          stream into which messages are written.
+         */
+        std::ofstream m_file;
+        std::ostream* m_out;
+
+        /**
+         * @brief - The slots of the buffer and the mask to apply
+         *          to a position to get its slot.
+         */
+        std::unique_ptr<Slot[]> m_slots;
+        std::size_t m_mask;
+
+        /**
+         * @brief - The next position to be written by producers,
+         *          on its own cache line as it is shared by all
+         *          of them.
+         */
+        alignas(64) std::atomic_size_t m_head;
+
+        /**
+         * @brief - The next position to be read by the background
+         *          thread. Only accessed by this thread.
+         */
+        alignas(64) std::size_t m_tail;
+
+        /**
+         * @brief - The number of messages dropped so far and the
+         *          count already reported in the output.
+         */
+        std::atomic_size_t m_dropped;
+        std::size_t m_reported;
+
+        /**
+         * @brief - Whether the background thread should keep
+         *          running.
+         */
+        std::atomic_bool m_running;
+
+        /**
+         * @brief - The background thread.
+         */
+        std::thread m_worker;
+    };
+
+  }
+}
+
+# include "LogSink.hxx"
+
+#endif    /* LOG_SINK_HH */
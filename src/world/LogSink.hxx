@@ -0,0 +1,18 @@
+#ifndef    LOG_SINK_HXX
+# define   LOG_SINK_HXX
+
+# include "LogSink.hh"
+
+namespace new_frontiers {
+  namespace logging {
+
+    inline
+    std::size_t
+    AsyncSink::dropped() const noexcept {
+      return m_dropped.load(std::memory_order_relaxed);
+    }
+
+  }
+}
+
+#endif    /* LOG_SINK_HXX */
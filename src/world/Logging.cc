@@ -0,0 +1,89 @@
+
+# include "Logging.hh"
+# include "LogSink.hh"
+
+namespace new_frontiers {
+  namespace logging {
+
+    namespace details {
+
+      std::atomic_int threshold(static_cast<int>(Level::Debug));
+
+      /**
+       * @brief - The sink receiving the messages of the macros,
+       *          if any.
+       */
+      std::atomic<AsyncSink*> sink(nullptr);
+
+      std::atomic<Site*> sites(nullptr);
+
+    }
+
+    const unsigned Site::sk_maxPerPeriod = 20u;
+
+    void
+    setLevel(Level level) noexcept {
+      details::threshold.store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+
+    void
+    install(AsyncSink* sink) noexcept {
+      details::sink.store(sink, std::memory_order_release);
+    }
+
+    AsyncSink*
+    sink() noexcept {
+      return details::sink.load(std::memory_order_acquire);
+    }
+
+    void
+    push(AsyncSink& sink,
+         Level level,
+         const std::string& name,
+         const std::string& message,
+         const std::string& cause) noexcept
+    {
+      sink.push(level, name, message, cause);
+    }
+
+    void
+    Site::roll(AsyncSink& sink, std::int64_t period) noexcept {
+      // Only one of the threads seeing the new period resets
+      // the counters.
+      std::int64_t current = m_period.load(std::memory_order_relaxed);
+      if (current == period || !m_period.compare_exchange_strong(current, period, std::memory_order_relaxed)) {
+        return;
+      }
+
+      report(sink);
+      m_count.store(0u, std::memory_order_relaxed);
+    }
+
+    void
+    Site::flush(AsyncSink& sink) noexcept {
+      Site* s = details::sites.load(std::memory_order_acquire);
+
+      while (s != nullptr) {
+        s->report(sink);
+        s = s->m_next;
+      }
+    }
+
+    void
+    Site::report(AsyncSink& sink) noexcept {
+      unsigned suppressed = m_suppressed.exchange(0u, std::memory_order_relaxed);
+      if (suppressed == 0u) {
+        return;
+      }
+
+      sink.push(
+        Level::Warning,
+        "sink",
+        "Suppressed " + std::to_string(suppressed) + " message(s) from " +
+        m_file + ":" + std::to_string(m_line),
+        std::string()
+      );
+    }
+
+  }
+}
@@ -0,0 +1,226 @@
+#ifndef    LOGGING_HH
+# define   LOGGING_HH
+
+# include <atomic>
+# include <string>
+# include <cstdint>
+
+/**
+ * @brief - The lowest level of the messages compiled in by
+ *          the `NF_DEBUG` and `NF_VERBOSE` macros below. It
+ *          follows the values of `logging::Level`: the release
+ *          builds usually raise it to strip the most verbose
+ *          messages from the binary.
+ */
+# ifndef NF_LOG_MIN_LEVEL
+#  define NF_LOG_MIN_LEVEL 0
+# endif
+
+namespace new_frontiers {
+  namespace logging {
+
+    // Forward declaration of the sink to avoid including
+    // it in every file logging messages.
+    class AsyncSink;
+
+    /**
+     * @brief - The levels of the messages which can be gated
+     *          before being built, from the most verbose to the
+     *          least verbose one.
+     */
+    enum class Level {
+      Debug = 0,
+      Verbose = 1,
+      Info = 2,
+      Warning = 3
+    };
+
+    /**
+     * @brief - Define the lowest level of the messages which are
+     *          still built and sent to the logger. This should be
+     *          kept in sync with the level of the logger itself:
+     *          messages it would filter out are then not even
+     *          built. All messages are built by default.
+     * @param level - the lowest level of the messages to build.
+     */
+    void
+    setLevel(Level level) noexcept;
+
+    /**
+     * @brief - Whether messages with the specified level are
+     *          compiled in.
+     * @param level - the level of the message.
+     * @return - `true` if the message is compiled in.
+     */
+    constexpr
+    bool
+    compiled(Level level) noexcept;
+
+    /**
+     * @brief - Whether messages with the specified level should
+     *          be built, both at compile time and at runtime.
+     * @param level - the level of the message.
+     * @return - `true` if the message should be built.
+     */
+    bool
+    enabled(Level level) noexcept;
+
+    /**
+     * @brief - Route the messages of the macros below to the
+     *          specified sink instead of the logger of the object
+     *          emitting them. The sink should outlive its use: it
+     *          is uninstalled by passing `null`.
+     * @param sink - the sink to use or `null`.
+     */
+    void
+    install(AsyncSink* sink) noexcept;
+
+    /**
+     * @brief - The sink currently installed if any.
+     * @return - the sink or `null`.
+     */
+    AsyncSink*
+    sink() noexcept;
+
+    /**
+     * @brief - Format a message and push it to the sink. This
+     *          does not block: the message is dropped in case the
+     *          sink is full.
+     * @param sink - the sink receiving the message.
+     * @param level - the level of the message.
+     * @param name - the name of the object emitting the message.
+     * @param message - the message.
+     * @param cause - an optional cause for the message.
+     */
+    void
+    push(AsyncSink& sink,
+         Level level,
+         const std::string& name,
+         const std::string& message,
+         const std::string& cause = std::string()) noexcept;
+
+    /**
+     * @brief - A location in the code emitting messages. Each
+     *          site is allowed a limited number of messages per
+     *          second when they are routed to a sink, so that a
+     *          single busy call site cannot flood the output. The
+     *          number of suppressed messages is reported once the
+     *          period is over.
+     */
+    class Site {
+      public:
+
+        /**
+         * @brief - Create a new site for the specified location.
+         * @param file - the file of the site, should be a string
+         *               literal.
+         * @param line - the line of the site.
+         */
+        Site(const char* file, int line) noexcept;
+
+        /**
+         * @brief - Whether a new message can be emitted by this
+         *          site in the current period.
+         * @param sink - the sink receiving the messages, used
+         *               to report suppressed messages.
+         * @return - `true` if the message can be emitted.
+         */
+        bool
+        admit(AsyncSink& sink) noexcept;
+
+        /**
+         * @brief - Report the messages suppressed by all the sites
+         *          during their current period. This is typically
+         *          used before a sink is stopped.
+         * @param sink - the sink to report to.
+         */
+        static
+        void
+        flush(AsyncSink& sink) noexcept;
+
+      private:
+
+        /**
+         * @brief - Start a new period and report the messages
+         *          suppressed during the previous one if any.
+         * @param sink - the sink to report to.
+         * @param period - the index of the new period.
+         */
+        void
+        roll(AsyncSink& sink, std::int64_t period) noexcept;
+
+        /**
+         * @brief - Report the messages suppressed so far during
+         *          the current period if any.
+         * @param sink - the sink to report to.
+         */
+        void
+        report(AsyncSink& sink) noexcept;
+
+      private:
+
+        /**
+         * @brief - The number of messages a site can emit during a
+         *          single period.
+         */
+        static const unsigned sk_maxPerPeriod;
+
+        /**
+         * @brief - The location of the site.
+         */
+        const char* m_file;
+        int m_line;
+
+        /**
+         * @brief - The index of the current period, the number of
+         *          messages emitted and suppressed during it.
+         */
+        std::atomic<std::int64_t> m_period;
+        std::atomic_uint m_count;
+        std::atomic_uint m_suppressed;
+
+        /**
+         * @brief - The site registered before this one: all the
+         *          sites are linked so that they can be flushed.
+         */
+        Site* m_next;
+    };
+
+  }
+}
+
+# include "Logging.hxx"
+
+/**
+ * @brief - Macros to log a message from an object providing the
+ *          corresponding method and a `getName` one (typically a
+ *          `CoreObject` or a `WorldElement`). The arguments are
+ *          only evaluated if the level is enabled, which avoids
+ *          formatting strings which would be discarded anyway.
+ *          When a sink is installed the message is pushed to it
+ *          subject to the rate limit of the call site, otherwise
+ *          it is given to the logger of the object.
+ *          Messages below `NF_LOG_MIN_LEVEL` are still compiled
+ *          so that their arguments are checked, but the branch is
+ *          always false and is removed by the compiler.
+ */
+# define NF_LOG_AT(level, method, ...) \
+  do { \
+    if (::new_frontiers::logging::enabled(level)) { \
+      static ::new_frontiers::logging::Site nf_log_site(__FILE__, __LINE__); \
+      ::new_frontiers::logging::AsyncSink* nf_log_sink = ::new_frontiers::logging::sink(); \
+      if (nf_log_sink == nullptr) { \
+        method(__VA_ARGS__); \
+      } \
+      else if (nf_log_site.admit(*nf_log_sink)) { \
+        ::new_frontiers::logging::push(*nf_log_sink, level, getName(), __VA_ARGS__); \
+      } \
+    } \
+  } while (false)
+
+# define NF_DEBUG(...) \
+  NF_LOG_AT(::new_frontiers::logging::Level::Debug, debug, __VA_ARGS__)
+# define NF_VERBOSE(...) \
+  NF_LOG_AT(::new_frontiers::logging::Level::Verbose, verbose, __VA_ARGS__)
+
+#endif    /* LOGGING_HH */
@@ -0,0 +1,76 @@
+#ifndef    LOGGING_HXX
+# define   LOGGING_HXX
+
+# include "Logging.hh"
+# include <chrono>
+
+namespace new_frontiers {
+  namespace logging {
+
+    namespace details {
+
+      /**
+       * @brief - The lowest level of the messages built at
+       *          runtime. Kept here so that the check can be
+       *          inlined at each call site.
+       */
+      extern std::atomic_int threshold;
+
+      /**
+       * @brief - The last site registered.
+       */
+      extern std::atomic<Site*> sites;
+
+    }
+
+    constexpr
+    bool
+    compiled(Level level) noexcept {
+      return static_cast<int>(level) >= NF_LOG_MIN_LEVEL;
+    }
+
+    inline
+    bool
+    enabled(Level level) noexcept {
+      return compiled(level) &&
+             static_cast<int>(level) >= details::threshold.load(std::memory_order_relaxed);
+    }
+
+    inline
+    Site::Site(const char* file, int line) noexcept:
+      m_file(file),
+      m_line(line),
+
+      m_period(0),
+      m_count(0u),
+      m_suppressed(0u),
+
+      m_next(details::sites.load(std::memory_order_relaxed))
+    {
+      while (!details::sites.compare_exchange_weak(m_next, this, std::memory_order_acq_rel)) {}
+    }
+
+    inline
+    bool
+    Site::admit(AsyncSink& sink) noexcept {
+      // Periods last one second.
+      std::int64_t period = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+      ).count();
+
+      if (period != m_period.load(std::memory_order_relaxed)) {
+        roll(sink, period);
+      }
+
+      if (m_count.fetch_add(1u, std::memory_order_relaxed) < sk_maxPerPeriod) {
+        return true;
+      }
+
+      m_suppressed.fetch_add(1u, std::memory_order_relaxed);
+      return false;
+    }
+
+  }
+}
+
+#endif    /* LOGGING_HXX */
@@ -0,0 +1,152 @@
+
+# include "Owner.hh"
+# include <bit>
+# include <atomic>
+# include <mutex>
+# include <shared_mutex>
+# include <unordered_map>
+
+namespace new_frontiers {
+  namespace owner {
+
+    namespace {
+
+      /**
+       * @brief - The description of an interned owner.
+       */
+      struct Entry {
+        utils::Uuid uuid;
+        std::string name;
+      };
+
+      /**
+       * @brief - The number of entries of the first segment of
+       *          the registry: each segment holds twice as many
+       *          entries as the previous one.
+       */
+      constexpr std::uint32_t sk_firstSegment = 16u;
+
+      /**
+       * @brief - The number of segments needed to hold as many
+       *          owners as `OwnerId` can address.
+       */
+      constexpr unsigned sk_segments = 29u;
+
+      /**
+       * @brief - The owners interned so far. The index of an
+       *          owner is its position in the registry plus one
+       *          so that `none` is never assigned.
+       *          Entries are stored in segments which are never
+       *          moved nor released: an entry is filled before
+       *          the count is published so that it can be read
+       *          without locking. The locker only serializes the
+       *          interning of new owners.
+       *          The registry is never deleted so that owners
+       *          can be converted up until the end of the program.
+       */
+      struct Registry {
+        std::shared_mutex locker;
+        std::unordered_map<std::string, OwnerId> ids;
+        Entry* segments[sk_segments] = {};
+        std::atomic_uint32_t count{0u};
+      };
+
+      Registry&
+      registry() noexcept {
+        static Registry* r = new Registry();
+        return *r;
+      }
+
+      const std::string&
+      empty() noexcept {
+        static const std::string s;
+        return s;
+      }
+
+      /**
+       * @brief - Locate the entry at the specified position in
+       *          the registry, allocating its segment if needed.
+       *          Allocations should only happen when interning.
+       * @param r - the registry.
+       * @param index - the position of the entry.
+       * @return - the entry.
+       */
+      Entry&
+      entry(Registry& r, std::uint32_t index) {
+        // Segment `k` starts at `first * (2^k - 1)`.
+        std::uint32_t slot = index / sk_firstSegment + 1u;
+        unsigned k = static_cast<unsigned>(std::bit_width(slot)) - 1u;
+        std::uint32_t begin = sk_firstSegment * ((1u << k) - 1u);
+
+        if (r.segments[k] == nullptr) {
+          r.segments[k] = new Entry[static_cast<std::size_t>(sk_firstSegment) << k];
+        }
+
+        return r.segments[k][index - begin];
+      }
+
+    }
+
+    OwnerId
+    intern(const utils::Uuid& uuid) {
+      if (!uuid.valid()) {
+        return none;
+      }
+
+      Registry& r = registry();
+      std::string key = uuid.toString();
+
+      // Owners are mostly interned when loading elements
+      // belonging to colonies which already exist.
+      {
+        std::shared_lock<std::shared_mutex> guard(r.locker);
+        auto it = r.ids.find(key);
+        if (it != r.ids.cend()) {
+          return it->second;
+        }
+      }
+
+      std::unique_lock<std::shared_mutex> guard(r.locker);
+      auto it = r.ids.find(key);
+      if (it != r.ids.cend()) {
+        return it->second;
+      }
+
+      std::uint32_t count = r.count.load(std::memory_order_relaxed);
+      Entry& e = entry(r, count);
+      e.uuid = uuid;
+      e.name = key;
+
+      OwnerId id = static_cast<OwnerId>(count + 1u);
+      r.ids[key] = id;
+
+      // Publish the entry to the readers.
+      r.count.store(count + 1u, std::memory_order_release);
+
+      return id;
+    }
+
+    utils::Uuid
+    uuid(OwnerId id) {
+      Registry& r = registry();
+
+      if (id == none || id > r.count.load(std::memory_order_acquire)) {
+        return utils::Uuid();
+      }
+
+      return entry(r, id - 1u).uuid;
+    }
+
+    const std::string&
+    name(OwnerId id) {
+      Registry& r = registry();
+
+      if (id == none || id > r.count.load(std::memory_order_acquire)) {
+        return empty();
+      }
+
+      return entry(r, id - 1u).name;
+    }
+
+  }
+}
@@ -0,0 +1,77 @@
+#ifndef    OWNER_HH
+# define   OWNER_HH
+
+# include <string>
+# include <cstdint>
+# include <core_utils/Uuid.hh>
+
+namespace new_frontiers {
+
+  /**
+   * @brief - Compact identifier of the owner of an element. The
+   *          colonies are identified by an uuid which is interned
+   *          once into an owner index: the simulation and the
+   *          rendering only manipulate these indices so that the
+   *          ownership checks are simple integer comparisons.
+   *          The uuids are only needed when reading or displaying
+   *          an owner.
+   */
+  using OwnerId = std::uint32_t;
+
+  namespace owner {
+
+    /**
+     * @brief - The index used for elements without owner. It
+     *          corresponds to any invalid uuid.
+     */
+    constexpr OwnerId none = 0u;
+
+    /**
+     * @brief - Whether the index refers to an actual owner.
+     * @param id - the index to check.
+     * @return - `true` if the index is not `none`.
+     */
+    bool
+    valid(OwnerId id) noexcept;
+
+    /**
+     * @brief - Retrieve the index associated to an uuid, assigning
+     *          a new one in case this uuid was never seen before.
+     *          The same uuid always yields the same index during
+     *          the execution of the program.
+     * @param uuid - the uuid to convert.
+     * @return - the index of the owner or `none` if the uuid is
+     *           not valid.
+     */
+    OwnerId
+    intern(const utils::Uuid& uuid);
+
+    /**
+     * @brief - Retrieve the uuid interned with the specified index.
+     * @param id - the index of the owner.
+     * @return - the uuid of the owner or an invalid uuid if the
+     *           index is `none` or unknown.
+     */
+    utils::Uuid
+    uuid(OwnerId id);
+
+    /**
+     * @brief - Retrieve a printable version of the uuid of the
+     *          owner. The string is computed once when the owner
+     *          is interned so that it can be displayed every frame
+     *          without building it again, and reading it does not
+     *          lock anything.
+     * @param id - the index of the owner.
+     * @return - the string representation of the uuid, empty if
+     *           the index is `none` or unknown.
+     */
+    const std::string&
+    name(OwnerId id);
+
+  }
+
+}
+
+# include "Owner.hxx"
+
+#endif    /* OWNER_HH */
@@ -0,0 +1,18 @@
+#ifndef    OWNER_HXX
+# define   OWNER_HXX
+
+# include "Owner.hh"
+
+namespace new_frontiers {
+  namespace owner {
+
+    inline
+    bool
+    valid(OwnerId id) noexcept {
+      return id != none;
+    }
+
+  }
+}
+
+#endif    /* OWNER_HXX */
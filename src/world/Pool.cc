@@ -0,0 +1,184 @@
+
+# include "Pool.hh"
+# include <new>
+# include <algorithm>
+# include "Logging.hh"
+
+namespace new_frontiers {
+
+  const std::size_t SlabPool::sk_blocksPerSlab = 256u;
+
+  SlabPool::SlabPool(const std::string& name,
+                     std::size_t size,
+                     std::size_t alignment):
+    utils::CoreObject(name),
+
+    m_name(name),
+    m_size(0u),
+    m_alignment(std::max(alignment, alignof(void*))),
+
+    m_locker(),
+    m_slabs(),
+    m_free(nullptr),
+
+    m_used(0u),
+    m_highWater(0u),
+    m_allocations(0u)
+  {
+    setService("pool");
+
+    // Free blocks hold a pointer to the next one so they
+    // should be large enough for that, and each block of
+    // a slab should be aligned.
+    m_size = std::max(size, sizeof(void*));
+    m_size = ((m_size + m_alignment - 1u) / m_alignment) * m_alignment;
+  }
+
+  SlabPool::~SlabPool() {
+    for (unsigned id = 0u ; id < m_slabs.size() ; ++id) {
+      ::operator delete(m_slabs[id], std::align_val_t(m_alignment));
+    }
+  }
+
+  void*
+  SlabPool::allocate() {
+    std::lock_guard<std::mutex> guard(m_locker);
+
+    if (m_free == nullptr) {
+      grow();
+    }
+
+    void* block = m_free;
+    m_free = *static_cast<void**>(block);
+
+    ++m_used;
+    ++m_allocations;
+    m_highWater = std::max(m_highWater, m_used);
+
+    return block;
+  }
+
+  void
+  SlabPool::deallocate(void* block) noexcept {
+    if (block == nullptr) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> guard(m_locker);
+
+    *static_cast<void**>(block) = m_free;
+    m_free = block;
+
+    --m_used;
+  }
+
+  void
+  SlabPool::checkBlockSize(std::size_t size) const {
+    if (size > m_size) {
+      error(
+        std::string("Cannot use pool for blocks of ") + std::to_string(size) + " byte(s)",
+        std::string("Pool serves blocks of ") + std::to_string(m_size) + " byte(s)"
+      );
+    }
+  }
+
+  SlabPool::Stats
+  SlabPool::stats() const {
+    std::lock_guard<std::mutex> guard(m_locker);
+
+    return Stats{
+      m_name,
+      m_size,
+      m_slabs.size(),
+      m_slabs.size() * sk_blocksPerSlab,
+      m_used,
+      m_highWater,
+      m_allocations
+    };
+  }
+
+  void
+  SlabPool::grow() {
+    char* slab = static_cast<char*>(
+      ::operator new(m_size * sk_blocksPerSlab, std::align_val_t(m_alignment))
+    );
+
+    m_slabs.push_back(slab);
+
+    // Chain the blocks of the slab so that they are handed
+    // out in address order.
+    for (std::size_t id = sk_blocksPerSlab ; id > 0u ; --id) {
+      void* block = slab + (id - 1u) * m_size;
+
+      *static_cast<void**>(block) = m_free;
+      m_free = block;
+    }
+
+    NF_VERBOSE(
+      "Allocated slab " + std::to_string(m_slabs.size()) +
+      " of " + std::to_string(sk_blocksPerSlab) + " block(s) of " +
+      std::to_string(m_size) + " byte(s)"
+    );
+  }
+
+  namespace pool {
+    namespace {
+
+      /**
+       * @brief - Convenience structure holding all the pools.
+       */
+      struct Registry {
+        std::mutex locker;
+        std::unordered_map<std::string, std::unique_ptr<SlabPool>> pools;
+      };
+
+      Registry&
+      registry() {
+        // The registry is never destroyed: some elements may
+        // still be released after the end of `main` and they
+        // need their pool to be valid.
+        static Registry* r = new Registry();
+        return *r;
+      }
+
+    }
+
+    SlabPool&
+    get(const std::string& name, std::size_t size, std::size_t alignment) {
+      Registry& r = registry();
+      std::lock_guard<std::mutex> guard(r.locker);
+
+      auto it = r.pools.find(name);
+      if (it == r.pools.end()) {
+        it = r.pools.emplace(name, std::make_unique<SlabPool>(name, size, alignment)).first;
+      }
+
+      it->second->checkBlockSize(size);
+
+      return *it->second;
+    }
+
+    std::vector<SlabPool::Stats>
+    stats() {
+      Registry& r = registry();
+      std::lock_guard<std::mutex> guard(r.locker);
+
+      std::vector<SlabPool::Stats> out;
+      for (auto it = r.pools.cbegin() ; it != r.pools.cend() ; ++it) {
+        out.push_back(it->second->stats());
+      }
+
+      std::sort(
+        out.begin(),
+        out.end(),
+        [](const SlabPool::Stats& lhs, const SlabPool::Stats& rhs) {
+          return lhs.name < rhs.name;
+        }
+      );
+
+      return out;
+    }
+
+  }
+
+}
@@ -0,0 +1,279 @@
+#ifndef    POOL_HH
+# define   POOL_HH
+
+# include <mutex>
+# include <memory>
+# include <string>
+# include <vector>
+# include <cstddef>
+# include <cstring>
+# include <unordered_map>
+# include <core_utils/CoreObject.hh>
+
+namespace new_frontiers {
+
+  /**
+   * @brief - An allocator serving blocks of a single size. The
+   *          memory is requested by slabs of several blocks and
+   *          released blocks are kept in a free list to be reused
+   *          by the next allocations: slabs are never given back
+   *          to the system. This avoids churning the general
+   *          purpose allocator with many objects of the same size
+   *          and keeps them close to each other in memory.
+   *          The pool can be used from several threads.
+   */
+  class SlabPool: public utils::CoreObject {
+    public:
+
+      /**
+       * @brief - Convenience structure describing the occupancy of
+       *          a pool.
+       */
+      struct Stats {
+        std::string name;
+
+        // Size of a block in bytes.
+        std::size_t block;
+
+        // Number of slabs allocated and total number of blocks
+        // they contain.
+        std::size_t slabs;
+        std::size_t capacity;
+
+        // Number of blocks currently used and highest number of
+        // blocks used at once.
+        std::size_t used;
+        std::size_t highWater;
+
+        // Number of allocations served since the creation of the
+        // pool.
+        std::size_t allocations;
+      };
+
+      /**
+       * @brief - Create a new pool serving blocks of the specified
+       *          size.
+       * @param name - the name of the pool.
+       * @param size - the size of the blocks in bytes.
+       * @param alignment - the alignment of the blocks in bytes.
+       */
+      SlabPool(const std::string& name,
+               std::size_t size,
+               std::size_t alignment);
+
+      /**
+       * @brief - Destruction of the pool: releases all the slabs.
+       *          Blocks should not be used anymore.
+       */
+      ~SlabPool();
+
+      /**
+       * @brief - Retrieve a free block from the pool, allocating a
+       *          new slab if needed.
+       * @return - a pointer to the block.
+       */
+      void*
+      allocate();
+
+      /**
+       * @brief - Return the block to the pool so that it can be
+       *          used by a later allocation.
+       * @param block - the block to release.
+       */
+      void
+      deallocate(void* block) noexcept;
+
+      /**
+       * @brief - Retrieve the size of the blocks served by this
+       *          pool.
+       * @return - the size of a block in bytes.
+       */
+      std::size_t
+      blockSize() const noexcept;
+
+      /**
+       * @brief - Make sure that the pool can serve objects of the
+       *          specified size. Raises an error if this is not the
+       *          case.
+       * @param size - the size of the objects to serve.
+       */
+      void
+      checkBlockSize(std::size_t size) const;
+
+      /**
+       * @brief - Describe the occupancy of this pool.
+       * @return - the statistics of the pool.
+       */
+      Stats
+      stats() const;
+
+    private:
+
+      /**
+       * @brief - Allocate a new slab and add its blocks to the free
+       *          list. Assumes that the locker is already acquired.
+       */
+      void
+      grow();
+
+    private:
+
+      /**
+       * @brief - The number of blocks in a slab.
+       */
+      static const std::size_t sk_blocksPerSlab;
+
+      /**
+       * @brief - The name of the pool.
+       */
+      std::string m_name;
+
+      /**
+       * @brief - The size and alignment of a block.
+       */
+      std::size_t m_size;
+      std::size_t m_alignment;
+
+      /**
+       * @brief - Protects the free list and the slabs.
+       */
+      mutable std::mutex m_locker;
+
+      /**
+       * @brief - The slabs allocated for this pool.
+       */
+      std::vector<void*> m_slabs;
+
+      /**
+       * @brief - The first free block: each free block stores the
+       *          address of the next one.
+       */
+      void* m_free;
+
+      /**
+       * @brief - The number of blocks currently used, the highest
+       *          number of blocks used at once and the number of
+       *          allocations served.
+       */
+      std::size_t m_used;
+      std::size_t m_highWater;
+      std::size_t m_allocations;
+  };
+
+  namespace pool {
+
+    /**
+     * @brief - Retrieve the pool with the specified name, creating
+     *          it if needed. Pools live until the end of the program.
+     *          An error is raised if a pool with this name already
+     *          serves blocks of another size.
+     * @param name - the name of the pool.
+     * @param size - the size of the blocks.
+     * @param alignment - the alignment of the blocks.
+     * @return - the pool.
+     */
+    SlabPool&
+    get(const std::string& name, std::size_t size, std::size_t alignment);
+
+    /**
+     * @brief - Describe the occupancy of all the pools created so
+     *          far, sorted by name.
+     * @return - the statistics of the pools.
+     */
+    std::vector<SlabPool::Stats>
+    stats();
+
+    /**
+     * @brief - An allocator drawing its memory from a pool. It is
+     *          meant to be used with `std::allocate_shared` so that
+     *          the object and its control block are allocated as a
+     *          single block of the pool. The pool is selected from
+     *          the name of the allocator and the size of the type
+     *          it is rebound to.
+     *          Allocations of more than one object are forwarded to
+     *          the general purpose allocator.
+     */
+    template <typename T>
+    class Allocator {
+      public:
+
+        using value_type = T;
+
+        /**
+         * @brief - Create a new allocator using the pool with the
+         *          specified name.
+         * @param name - the name of the pool, should be a string
+         *               literal.
+         */
+        explicit
+        Allocator(const char* name) noexcept;
+
+        /**
+         * @brief - Rebind an allocator to another type.
+         * @param rhs - the allocator to rebind.
+         */
+        template <typename U>
+        Allocator(const Allocator<U>& rhs) noexcept;
+
+        T*
+        allocate(std::size_t n);
+
+        void
+        deallocate(T* p, std::size_t n) noexcept;
+
+        /**
+         * @brief - The name of the pool used by this allocator.
+         * @return - the name of the pool.
+         */
+        const char*
+        name() const noexcept;
+
+      private:
+
+        /**
+         * @brief - Retrieve the pool serving objects of type `T`
+         *          with the name of this allocator. It is looked
+         *          up on first use: `std::allocate_shared` only
+         *          allocates through a rebound copy so the pool
+         *          is never needed for the initial type.
+         * @return - the pool.
+         */
+        SlabPool&
+        pool() const;
+
+      private:
+
+        /**
+         * @brief - The name of the pool.
+         */
+        const char* m_name;
+
+        /**
+         * @brief - The pool used by this allocator, `null` until
+         *          it is first needed.
+         */
+        mutable SlabPool* m_pool;
+    };
+
+    template <typename T, typename U>
+    bool
+    operator==(const Allocator<T>& lhs, const Allocator<U>& rhs) noexcept;
+
+    /**
+     * @brief - Create a new object shared through a pointer from
+     *          the pool with the specified name.
+     * @param name - the name of the pool, should be a string literal.
+     * @param args - the arguments to forward to the constructor.
+     * @return - the created object.
+     */
+    template <typename T, typename... Args>
+    std::shared_ptr<T>
+    make(const char* name, Args&&... args);
+
+  }
+
+}
+
+# include "Pool.hxx"
+
+#endif    /* POOL_HH */
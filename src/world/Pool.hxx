@@ -0,0 +1,92 @@
+#ifndef    POOL_HXX
+# define   POOL_HXX
+
+# include "Pool.hh"
+
+namespace new_frontiers {
+
+  inline
+  std::size_t
+  SlabPool::blockSize() const noexcept {
+    return m_size;
+  }
+
+  namespace pool {
+
+    template <typename T>
+    inline
+    Allocator<T>::Allocator(const char* name) noexcept:
+      m_name(name),
+      m_pool(nullptr)
+    {}
+
+    template <typename T>
+    template <typename U>
+    inline
+    Allocator<T>::Allocator(const Allocator<U>& rhs) noexcept:
+      m_name(rhs.name()),
+      // The blocks of `T` may have another size than the
+      // ones of `U`: the pool is looked up again.
+      m_pool(nullptr)
+    {}
+
+    template <typename T>
+    inline
+    T*
+    Allocator<T>::allocate(std::size_t n) {
+      if (n != 1u) {
+        return std::allocator<T>().allocate(n);
+      }
+
+      return static_cast<T*>(pool().allocate());
+    }
+
+    template <typename T>
+    inline
+    void
+    Allocator<T>::deallocate(T* p, std::size_t n) noexcept {
+      if (n != 1u) {
+        std::allocator<T>().deallocate(p, n);
+        return;
+      }
+
+      pool().deallocate(p);
+    }
+
+    template <typename T>
+    inline
+    const char*
+    Allocator<T>::name() const noexcept {
+      return m_name;
+    }
+
+    template <typename T>
+    inline
+    SlabPool&
+    Allocator<T>::pool() const {
+      if (m_pool == nullptr) {
+        m_pool = &get(m_name, sizeof(T), alignof(T));
+      }
+
+      return *m_pool;
+    }
+
+    template <typename T, typename U>
+    inline
+    bool
+    operator==(const Allocator<T>& lhs, const Allocator<U>& rhs) noexcept {
+      return std::strcmp(lhs.name(), rhs.name()) == 0;
+    }
+
+    template <typename T, typename... Args>
+    inline
+    std::shared_ptr<T>
+    make(const char* name, Args&&... args) {
+      return std::allocate_shared<T>(Allocator<T>(name), std::forward<Args>(args)...);
+    }
+
+  }
+
+}
+
+#endif    /* POOL_HXX */
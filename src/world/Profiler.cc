@@ -0,0 +1,119 @@
+
+# include "Profiler.hh"
+# include <algorithm>
+
+namespace new_frontiers {
+
+  const unsigned Profiler::sk_samples = 256u;
+
+  Profiler::Profiler(const std::string& name,
+                     const std::vector<std::string>& sections):
+    utils::CoreObject(name),
+
+    m_locker(),
+    m_sections(),
+    m_ticks(0u),
+    m_csv()
+  {
+    setService("profiler");
+
+    for (unsigned id = 0u ; id < sections.size() ; ++id) {
+      SectionShPtr s = std::make_shared<Section>();
+
+      s->name = sections[id];
+      s->current = 0;
+      s->samples.resize(sk_samples, 0.0f);
+
+      m_sections.push_back(s);
+    }
+  }
+
+  void
+  Profiler::tick() {
+    std::lock_guard<std::mutex> guard(m_locker);
+
+    unsigned slot = m_ticks % sk_samples;
+
+    if (m_csv.is_open()) {
+      m_csv << m_ticks;
+    }
+
+    for (unsigned id = 0u ; id < m_sections.size() ; ++id) {
+      Section& s = *m_sections[id];
+
+      std::int64_t ns = s.current.exchange(0, std::memory_order_relaxed);
+      s.samples[slot] = std::chrono::duration<float, std::milli>(std::chrono::nanoseconds(ns)).count();
+
+      if (m_csv.is_open()) {
+        m_csv << "," << s.samples[slot];
+      }
+    }
+
+    if (m_csv.is_open()) {
+      m_csv << "\n";
+    }
+
+    ++m_ticks;
+  }
+
+  std::vector<Profiler::Stats>
+  Profiler::stats() const {
+    std::lock_guard<std::mutex> guard(m_locker);
+
+    std::vector<Stats> out;
+    unsigned count = std::min(m_ticks, sk_samples);
+
+    std::vector<float> sorted;
+
+    for (unsigned id = 0u ; id < m_sections.size() ; ++id) {
+      const Section& s = *m_sections[id];
+      Stats st{s.name, 0.0f, 0.0f, 0.0f, 0.0f};
+
+      if (count > 0u) {
+        st.last = s.samples[(m_ticks - 1u) % sk_samples];
+
+        sorted.assign(s.samples.cbegin(), s.samples.cbegin() + count);
+        std::sort(sorted.begin(), sorted.end());
+
+        st.p50 = sorted[(50u * (count - 1u)) / 100u];
+        st.p95 = sorted[(95u * (count - 1u)) / 100u];
+        st.p99 = sorted[(99u * (count - 1u)) / 100u];
+      }
+
+      out.push_back(st);
+    }
+
+    return out;
+  }
+
+  void
+  Profiler::dump(const std::string& file) {
+    std::lock_guard<std::mutex> guard(m_locker);
+
+    if (m_csv.is_open()) {
+      m_csv.close();
+    }
+
+    if (file.empty()) {
+      return;
+    }
+
+    m_csv.open(file.c_str(), std::ios::out | std::ios::trunc);
+    if (!m_csv.good()) {
+      warn("Failed to open \"" + file + "\" to export profiling data");
+      m_csv.close();
+
+      return;
+    }
+
+    // Write the header of the file.
+    m_csv << "tick";
+    for (unsigned id = 0u ; id < m_sections.size() ; ++id) {
+      m_csv << "," << m_sections[id]->name;
+    }
+    m_csv << "\n";
+
+    info("Exporting profiling data to \"" + file + "\"");
+  }
+
+}
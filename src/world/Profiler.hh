@@ -0,0 +1,193 @@
+#ifndef    PROFILER_HH
+# define   PROFILER_HH
+
+# include <mutex>
+# include <atomic>
+# include <chrono>
+# include <memory>
+# include <string>
+# include <vector>
+# include <cstdint>
+# include <fstream>
+# include <core_utils/CoreObject.hh>
+
+namespace new_frontiers {
+
+  /**
+   * @brief - Measures the time spent in a fixed set of sections
+   *          of code, tick after tick. The durations recorded in
+   *          a section during a tick are summed up: when the tick
+   *          ends they are stored in a ring buffer keeping the
+   *          last `sk_samples` ticks, from which percentiles can
+   *          be computed. Each tick can also be written as a row
+   *          of a CSV file for offline analysis.
+   *          Durations can be recorded from any thread while the
+   *          ticks should be ended by a single thread. Statistics
+   *          can be fetched from any thread.
+   */
+  class Profiler: public utils::CoreObject {
+    public:
+
+      /**
+       * @brief - Convenience structure describing the durations
+       *          measured for a section over the last ticks. All
+       *          durations are expressed in milliseconds.
+       */
+      struct Stats {
+        std::string name;
+
+        float last;
+        float p50;
+        float p95;
+        float p99;
+      };
+
+      /**
+       * @brief - Create a new profiler measuring the sections with
+       *          the specified names. The index of a section is its
+       *          position in the list.
+       * @param name - the name of the profiler.
+       * @param sections - the names of the sections to measure.
+       */
+      Profiler(const std::string& name,
+               const std::vector<std::string>& sections);
+
+      /**
+       * @brief - Desctruction of the object.
+       */
+      ~Profiler() = default;
+
+      /**
+       * @brief - Add the input duration to the time spent in the
+       *          section during the current tick.
+       * @param section - the index of the section.
+       * @param d - the duration to add.
+       */
+      void
+      record(unsigned section, const std::chrono::nanoseconds& d) noexcept;
+
+      /**
+       * @brief - End the current tick: the time spent in each of
+       *          the sections is registered and reset for the next
+       *          tick.
+       */
+      void
+      tick();
+
+      /**
+       * @brief - Compute the statistics of each section over the
+       *          last ticks.
+       * @return - the statistics of each section, in the order in
+       *           which they were declared.
+       */
+      std::vector<Stats>
+      stats() const;
+
+      /**
+       * @brief - Start writing each tick as a row of the specified
+       *          CSV file. Any previous file is closed. An empty
+       *          name stops the export.
+       * @param file - the name of the file to write.
+       */
+      void
+      dump(const std::string& file);
+
+      /**
+       * @brief - Whether the ticks are currently exported to a CSV
+       *          file.
+       * @return - `true` if a CSV file is being written.
+       */
+      bool
+      dumping() const;
+
+    private:
+
+      /**
+       * @brief - Convenience structure holding the measures of a
+       *          section.
+       */
+      struct Section {
+        std::string name;
+
+        // The time spent in the section during the current
+        // tick, in nanoseconds.
+        std::atomic<std::int64_t> current;
+
+        // The time spent in the section during the previous
+        // ticks, in milliseconds.
+        std::vector<float> samples;
+      };
+
+      using SectionShPtr = std::shared_ptr<Section>;
+
+      /**
+       * @brief - The number of ticks kept to compute statistics.
+       */
+      static const unsigned sk_samples;
+
+      /**
+       * @brief - Protects the samples and the CSV file.
+       */
+      mutable std::mutex m_locker;
+
+      /**
+       * @brief - The sections measured by the profiler.
+       */
+      std::vector<SectionShPtr> m_sections;
+
+      /**
+       * @brief - The number of ticks registered so far.
+       */
+      unsigned m_ticks;
+
+      /**
+       * @brief - The CSV file into which ticks are written if any.
+       */
+      std::ofstream m_csv;
+  };
+
+  using ProfilerShPtr = std::shared_ptr<Profiler>;
+
+  /**
+   * @brief - Measures the time spent in a scope and adds it to a
+   *          section of a profiler when the scope is left.
+   */
+  class ScopedTimer {
+    public:
+
+      /**
+       * @brief - Start measuring the time spent in the section.
+       * @param profiler - the profiler to record the duration in.
+       * @param section - the index of the section to measure.
+       */
+      ScopedTimer(Profiler& profiler, unsigned section) noexcept;
+
+      /**
+       * @brief - Record the time elapsed since the creation of
+       *          the timer.
+       */
+      ~ScopedTimer();
+
+    private:
+
+      /**
+       * @brief - The profiler to record the duration in.
+       */
+      Profiler& m_profiler;
+
+      /**
+       * @brief - The index of the section measured.
+       */
+      unsigned m_section;
+
+      /**
+       * @brief - The moment the measure started.
+       */
+      std::chrono::steady_clock::time_point m_start;
+  };
+
+}
+
+# include "Profiler.hxx"
+
+#endif    /* PROFILER_HH */
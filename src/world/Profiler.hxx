@@ -0,0 +1,35 @@
+#ifndef    PROFILER_HXX
+# define   PROFILER_HXX
+
+# include "Profiler.hh"
+
+namespace new_frontiers {
+
+  inline
+  void
+  Profiler::record(unsigned section, const std::chrono::nanoseconds& d) noexcept {
+    m_sections[section]->current.fetch_add(d.count(), std::memory_order_relaxed);
+  }
+
+  inline
+  bool
+  Profiler::dumping() const {
+    std::lock_guard<std::mutex> guard(m_locker);
+    return m_csv.is_open();
+  }
+
+  inline
+  ScopedTimer::ScopedTimer(Profiler& profiler, unsigned section) noexcept:
+    m_profiler(profiler),
+    m_section(section),
+    m_start(std::chrono::steady_clock::now())
+  {}
+
+  inline
+  ScopedTimer::~ScopedTimer() {
+    m_profiler.record(m_section, std::chrono::steady_clock::now() - m_start);
+  }
+
+}
+
+#endif    /* PROFILER_HXX */
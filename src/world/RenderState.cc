@@ -0,0 +1,149 @@
+
+# include "RenderState.hh"
+# include <algorithm>
+# include "Trace.hh"
+
+namespace {
+
+  /**
+   * @brief - Convenience method to determine whether the input
+   *          owner is rejected by the filter.
+   * @param filter - the filter, might be `null`.
+   * @param owner - the owner to check.
+   * @return - `true` if the item should be rejected.
+   */
+  inline
+  bool
+  rejected(const new_frontiers::world::Filter* filter,
+           new_frontiers::OwnerId owner) noexcept
+  {
+    return filter != nullptr &&
+      (
+        (filter->include && owner != filter->id) ||
+        (!filter->include && owner == filter->id)
+      );
+  }
+
+  /**
+   * @brief - Convenience method to determine whether the input
+   *          position lies outside of the specified area.
+   * @param p - the position to check.
+   * @param xMin - the minimum abscissa of the area.
+   * @param yMin - the minimum ordinate of the area.
+   * @param xMax - the maximum abscissa of the area.
+   * @param yMax - the maximum ordinate of the area.
+   * @return - `true` if the position is outside of the area.
+   */
+  inline
+  bool
+  outside(const utils::Point2f& p,
+          float xMin,
+          float yMin,
+          float xMax,
+          float yMax) noexcept
+  {
+    return p.x() < xMin || p.x() > xMax || p.y() < yMin || p.y() > yMax;
+  }
+
+}
+
+namespace new_frontiers {
+
+  void
+  RenderState::capture(const Locator& loc) {
+    m_w = loc.w();
+    m_h = loc.h();
+
+    m_blocks.clear();
+    for (int id = 0 ; id < loc.blocksCount() ; ++id) {
+      m_blocks.push_back(loc.block(id));
+    }
+
+    m_entities.clear();
+    for (int id = 0 ; id < loc.entitiesCount() ; ++id) {
+      m_entities.push_back(loc.entity(id));
+    }
+
+    m_vfxs.clear();
+    for (int id = 0 ; id < loc.vfxsCount() ; ++id) {
+      m_vfxs.push_back(loc.vfx(id));
+    }
+
+    m_colonies.clear();
+    for (int id = 0 ; id < loc.coloniesCount() ; ++id) {
+      m_colonies.push_back(loc.colony(id));
+    }
+  }
+
+  std::vector<world::ItemEntry>
+  RenderState::getVisible(float xMin,
+                          float yMin,
+                          float xMax,
+                          float yMax,
+                          const world::ItemType* type,
+                          const world::Filter* filter,
+                          world::Sort sort) const noexcept
+  {
+    TRACE_NAMED_ZONE(zone, "render::getVisible");
+
+    // Gather the position of each item along with the
+    // entry so that we can sort them afterwards.
+    std::vector<std::pair<utils::Point2f, world::ItemEntry>> entries;
+
+    if (type == nullptr || *type == world::ItemType::Block) {
+      for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
+        const world::Block& b = m_blocks[id];
+
+        if (!outside(b.tile.p, xMin, yMin, xMax, yMax) && !rejected(filter, b.owner)) {
+          entries.emplace_back(b.tile.p, world::ItemEntry{world::ItemType::Block, static_cast<int>(id)});
+        }
+      }
+    }
+
+    if (type == nullptr || *type == world::ItemType::Entity) {
+      for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
+        const world::Entity& e = m_entities[id];
+
+        if (!outside(e.tile.p, xMin, yMin, xMax, yMax) && !rejected(filter, e.owner)) {
+          entries.emplace_back(e.tile.p, world::ItemEntry{world::ItemType::Entity, static_cast<int>(id)});
+        }
+      }
+    }
+
+    if (type == nullptr || *type == world::ItemType::VFX) {
+      for (unsigned id = 0u ; id < m_vfxs.size() ; ++id) {
+        const world::VFX& v = m_vfxs[id];
+
+        if (!outside(v.tile.p, xMin, yMin, xMax, yMax) && !rejected(filter, v.owner)) {
+          entries.emplace_back(v.tile.p, world::ItemEntry{world::ItemType::VFX, static_cast<int>(id)});
+        }
+      }
+    }
+
+    // Sort by ascending `z` order if needed: similarly
+    // to the locator we don't have any reference point
+    // to sort by distance.
+    if (sort != world::Sort::None) {
+      std::stable_sort(
+        entries.begin(),
+        entries.end(),
+        [](const auto& lhs, const auto& rhs) {
+          return lhs.first.x() < rhs.first.x() ||
+            (lhs.first.x() == rhs.first.x() && lhs.first.y() < rhs.first.y());
+        }
+      );
+    }
+
+    std::vector<world::ItemEntry> out;
+    out.reserve(entries.size());
+
+    for (unsigned id = 0u ; id < entries.size() ; ++id) {
+      out.push_back(entries[id].second);
+    }
+
+    TRACE_ARG(zone, "count", out.size());
+
+    return out;
+  }
+
+}
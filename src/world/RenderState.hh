@@ -0,0 +1,149 @@
+#ifndef    RENDER_STATE_HH
+# define   RENDER_STATE_HH
+
+# include <vector>
+# include <memory>
+# include "Locator.hh"
+
+namespace new_frontiers {
+
+  /**
+   * @brief - A snapshot of the elements of the world which is
+   *          suited for rendering. It is captured from the
+   *          locator of the world at the end of a simulation
+   *          tick and can then be read without any lock while
+   *          the world keeps evolving.
+   *          The interface mimics the one of the locator for
+   *          all the rendering related queries.
+   */
+  class RenderState {
+    public:
+
+      /**
+       * @brief - Create a new empty render state.
+       */
+      RenderState();
+
+      /**
+       * @brief - Capture the state of the world through the input
+       *          locator. Any previous content is discarded but
+       *          the allocated memory is reused.
+       * @param loc - the locator to use to access the world.
+       */
+      void
+      capture(const Locator& loc);
+
+      /**
+       * @brief - Return the width of the world in cells.
+       * @return - the width of the world.
+       */
+      int
+      w() const noexcept;
+
+      /**
+       * @brief - Return the height of the world in cells.
+       * @return - the height of the world.
+       */
+      int
+      h() const noexcept;
+
+      /**
+       * @brief - Retrieve the block at the specified index. No
+       *          checks are performed on the index.
+       * @param id - index of the block to access.
+       * @return - the block at the specified index.
+       */
+      const world::Block&
+      block(int id) const noexcept;
+
+      /**
+       * @brief - Similar to `block` but for entities.
+       * @param id - the index of the entity to get.
+       * @return - the corresponding entity.
+       */
+      const world::Entity&
+      entity(int id) const noexcept;
+
+      /**
+       * @brief - Similar to `block` but for visual effects.
+       * @param id - the index of the VFX to get.
+       * @return - the corresponding VFX.
+       */
+      const world::VFX&
+      vfx(int id) const noexcept;
+
+      /**
+       * @brief - Return the number of colonies of the world.
+       * @return - the number of colonies.
+       */
+      int
+      coloniesCount() const noexcept;
+
+      /**
+       * @brief - Retrieve the colony at the specified index.
+       * @param id - the index of the colony to get.
+       * @return - the corresponding colony.
+       */
+      const world::Colony&
+      colony(int id) const noexcept;
+
+      /**
+       * @brief - Same as `Locator::getVisible` but operates on
+       *          the captured elements.
+       * @param xMin - the minimum abscissa of the area.
+       * @param yMin - the minimum ordinate of the area.
+       * @param xMax - the maximum abscissa of the area.
+       * @param yMax - the maximum ordinate of the area.
+       * @param type - a filter on the type of items to fetch.
+       * @param filter - a filter on the owner of the items.
+       * @param sort - the sort to apply on the items.
+       * @return - the list of items visible in the area.
+       */
+      std::vector<world::ItemEntry>
+      getVisible(float xMin,
+                 float yMin,
+                 float xMax,
+                 float yMax,
+                 const world::ItemType* type = nullptr,
+                 const world::Filter* filter = nullptr,
+                 world::Sort sort = world::Sort::None) const noexcept;
+
+    private:
+
+      /**
+       * @brief - Width of the world in cells.
+       */
+      int m_w;
+
+      /**
+       * @brief - Height of the world in cells.
+       */
+      int m_h;
+
+      /**
+       * @brief - The captured blocks.
+       */
+      std::vector<world::Block> m_blocks;
+
+      /**
+       * @brief - The captured entities.
+       */
+      std::vector<world::Entity> m_entities;
+
+      /**
+       * @brief - The captured visual effects.
+       */
+      std::vector<world::VFX> m_vfxs;
+
+      /**
+       * @brief - The captured colonies.
+       */
+      std::vector<world::Colony> m_colonies;
+  };
+
+  using RenderStateShPtr = std::shared_ptr<RenderState>;
+}
+
+# include "RenderState.hxx"
+
+#endif    /* RENDER_STATE_HH */
@@ -0,0 +1,63 @@
+#ifndef    RENDER_STATE_HXX
+# define   RENDER_STATE_HXX
+
+# include "RenderState.hh"
+
+namespace new_frontiers {
+
+  inline
+  RenderState::RenderState():
+    m_w(0),
+    m_h(0),
+
+    m_blocks(),
+    m_entities(),
+    m_vfxs(),
+    m_colonies()
+  {}
+
+  inline
+  int
+  RenderState::w() const noexcept {
+    return m_w;
+  }
+
+  inline
+  int
+  RenderState::h() const noexcept {
+    return m_h;
+  }
+
+  inline
+  const world::Block&
+  RenderState::block(int id) const noexcept {
+    return m_blocks[id];
+  }
+
+  inline
+  const world::Entity&
+  RenderState::entity(int id) const noexcept {
+    return m_entities[id];
+  }
+
+  inline
+  const world::VFX&
+  RenderState::vfx(int id) const noexcept {
+    return m_vfxs[id];
+  }
+
+  inline
+  int
+  RenderState::coloniesCount() const noexcept {
+    return static_cast<int>(m_colonies.size());
+  }
+
+  inline
+  const world::Colony&
+  RenderState::colony(int id) const noexcept {
+    return m_colonies[id];
+  }
+
+}
+
+#endif    /* RENDER_STATE_HXX */
@@ -0,0 +1,161 @@
+
+# include "Simulation.hh"
+# include <chrono>
+# include "Logging.hh"
+
+namespace new_frontiers {
+
+  const float Simulation::sk_tickDuration = 1.0f / 60.0f;
+
+  const float Simulation::sk_maxDebt = 0.25f;
+
+  const unsigned Simulation::sk_commandsCapacity = 1024u;
+
+  const unsigned Simulation::sk_fresh = 0x4u;
+
+  Simulation::Simulation(WorldShPtr world):
+    utils::CoreObject("simulation"),
+
+    m_world(world),
+    m_commands(sk_commandsCapacity),
+
+    m_thread(),
+    m_terminate(false),
+
+    m_controls(controls::newState()),
+    m_running(true),
+    m_speed(1u),
+    m_debt(0.0f),
+
+    m_buffers(),
+    m_front(0u),
+    m_back(1u),
+    m_ready(2u)
+  {
+    setService("world");
+
+    if (m_world == nullptr) {
+      error(
+        std::string("Unable to create simulation"),
+        std::string("Invalid null world")
+      );
+    }
+  }
+
+  void
+  Simulation::start() {
+    if (m_thread.joinable()) {
+      warn("Simulation is already running");
+      return;
+    }
+
+    // Publish a first state so that there's something
+    // to render even before the first tick.
+    publish();
+
+    m_terminate = false;
+    m_thread = std::thread(&Simulation::run, this);
+  }
+
+  void
+  Simulation::stop() {
+    if (!m_thread.joinable()) {
+      return;
+    }
+
+    m_terminate = true;
+    m_thread.join();
+  }
+
+  bool
+  Simulation::post(CommandQueue::Command cmd) {
+    if (!m_commands.push(std::move(cmd))) {
+      warn("Dropping command as the simulation is lagging behind");
+      return false;
+    }
+
+    return true;
+  }
+
+  void
+  Simulation::run() {
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point last = Clock::now();
+
+    while (!m_terminate) {
+      // Apply the commands posted since the last
+      // iteration: the world changes so we need a
+      // new render state.
+      bool dirty = false;
+      CommandQueue::Command cmd;
+
+      while (m_commands.pop(cmd)) {
+        cmd(*m_world);
+        dirty = true;
+      }
+
+      Clock::time_point now = Clock::now();
+      float elapsed = std::chrono::duration<float>(now - last).count();
+      last = now;
+
+      if (m_running && simulate(elapsed) > 0u) {
+        dirty = true;
+      }
+
+      if (dirty) {
+        publish();
+      }
+
+      // Wait for the next tick to be due. When paused we
+      // still wake up regularly to process commands.
+      float wait = sk_tickDuration;
+      if (m_running) {
+        wait = std::max(sk_tickDuration - m_debt, 0.0f) / m_speed;
+      }
+
+      std::this_thread::sleep_for(std::chrono::duration<float>(wait));
+    }
+  }
+
+  unsigned
+  Simulation::simulate(float elapsed) {
+    // Accumulate the simulated time corresponding to
+    // the real time elapsed since the last iteration
+    // and drop any excess debt.
+    m_debt += elapsed * m_speed;
+
+    float maxDebt = sk_maxDebt * m_speed;
+    if (m_debt > maxDebt) {
+      NF_VERBOSE(
+        "Dropping " + std::to_string(m_debt - maxDebt) + "s of simulation" +
+        " (speed: x" + std::to_string(m_speed) + ")"
+      );
+
+      m_debt = maxDebt;
+    }
+
+    // Consume the debt by fixed ticks: only the state
+    // reached after the last one will be published.
+    unsigned ticks = 0u;
+
+    while (m_debt >= sk_tickDuration) {
+      m_world->step(sk_tickDuration, m_controls);
+      m_debt -= sk_tickDuration;
+      ++ticks;
+    }
+
+    return ticks;
+  }
+
+  void
+  Simulation::publish() {
+    m_buffers[m_back].capture(*m_world->locator());
+
+    // Swap the back buffer with the ready one and flag
+    // it as fresh so that the renderer picks it.
+    unsigned ready = m_ready.exchange(m_back | sk_fresh, std::memory_order_acq_rel);
+    m_back = ready & ~sk_fresh;
+  }
+
+}
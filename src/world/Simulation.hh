@@ -0,0 +1,256 @@
+#ifndef    SIMULATION_HH
+# define   SIMULATION_HH
+
+# include <array>
+# include <atomic>
+# include <memory>
+# include <thread>
+# include <core_utils/CoreObject.hh>
+# include "World.hh"
+# include "Controls.hh"
+# include "RenderState.hh"
+# include "CommandQueue.hh"
+
+namespace new_frontiers {
+
+  class Simulation: public utils::CoreObject {
+    public:
+
+      /**
+       * @brief - Create a new simulation for the input world. The
+       *          world is not stepped until `start` is called: at
+       *          this point it should only be accessed through
+       *          the commands posted to the simulation.
+       * @param world - the world to simulate.
+       */
+      Simulation(WorldShPtr world);
+
+      /**
+       * @brief - Desctruction of the object. Stops the thread of
+       *          the simulation if needed.
+       */
+      ~Simulation();
+
+      /**
+       * @brief - Start the simulation thread. A first render state
+       *          is published before this method returns.
+       */
+      void
+      start();
+
+      /**
+       * @brief - Stop the simulation thread and wait for it to be
+       *          done with the current tick.
+       */
+      void
+      stop();
+
+      /**
+       * @brief - Register a command to be executed on the world by
+       *          the simulation thread before the next tick. Only
+       *          one thread should post commands.
+       * @param cmd - the command to execute.
+       * @return - `false` if the command could not be registered.
+       */
+      bool
+      post(CommandQueue::Command cmd);
+
+      /**
+       * @brief - Define the state of the controls that should be
+       *          provided to the world for the next ticks.
+       * @param controls - the state of the controls.
+       */
+      void
+      setControls(const controls::State& controls);
+
+      /**
+       * @brief - Define the area of the world displayed on screen
+       *          for the next ticks. See `World::setViewport`.
+       * @param xMin - the minimum abscissa of the area in cells.
+       * @param yMin - the minimum ordinate of the area in cells.
+       * @param xMax - the maximum abscissa of the area in cells.
+       * @param yMax - the maximum ordinate of the area in cells.
+       */
+      void
+      setViewport(float xMin, float yMin, float xMax, float yMax);
+
+      /**
+       * @brief - Pause the simulation: the world is not stepped
+       *          anymore until `resume` is called. As the time of
+       *          the simulation only advances with steps, nothing
+       *          else is needed.
+       */
+      void
+      pause();
+
+      /**
+       * @brief - Resume the simulation after a call to `pause`.
+       */
+      void
+      resume();
+
+      /**
+       * @brief - Define the speed multiplier of the simulation: a
+       *          value of `2` means that two seconds of simulated
+       *          time elapse for each second of real time.
+       * @param speed - the new speed multiplier.
+       */
+      void
+      setSpeed(unsigned speed);
+
+      /**
+       * @brief - Retrieve the latest state published by the world.
+       *          The returned reference stays valid and is not
+       *          modified until the next call to this method. It
+       *          should always be called from the same thread.
+       * @return - the latest render state of the world.
+       */
+      const RenderState&
+      acquire();
+
+      /**
+       * @brief - Return the profiler measuring the steps of the
+       *          world. Unlike the world itself it can be safely
+       *          accessed from any thread.
+       * @return - the profiler of the world.
+       */
+      ProfilerShPtr
+      profiler() const noexcept;
+
+    private:
+
+      /**
+       * @brief - Main loop of the simulation thread: process the
+       *          pending commands, step the world with a fixed
+       *          tick and publish the result.
+       */
+      void
+      run();
+
+      /**
+       * @brief - Used to make the world evolve to account for the
+       *          input duration of real time. The world advances
+       *          by fixed ticks of `sk_tickDuration` seconds times
+       *          the speed multiplier: the remainder is kept for
+       *          the next iterations.
+       * @param elapsed - the duration of real time elapsed since
+       *                  the last iteration in seconds.
+       * @return - the number of ticks performed.
+       */
+      unsigned
+      simulate(float elapsed);
+
+      /**
+       * @brief - Capture the current state of the world in the back
+       *          buffer and make it available for rendering.
+       */
+      void
+      publish();
+
+    private:
+
+      /**
+       * @brief - The duration of a single simulation tick in
+       *          seconds. The world always evolves with this
+       *          fixed time step, no matter the frame rate.
+       */
+      static const float sk_tickDuration;
+
+      /**
+       * @brief - The maximum duration of real time (in seconds)
+       *          that the simulation can lag behind. Any delay
+       *          in excess of this value is dropped.
+       */
+      static const float sk_maxDebt;
+
+      /**
+       * @brief - The maximum number of commands that can wait to
+       *          be processed by the simulation.
+       */
+      static const unsigned sk_commandsCapacity;
+
+      /**
+       * @brief - Flag set on the index of the ready buffer when
+       *          it contains a state not yet acquired.
+       */
+      static const unsigned sk_fresh;
+
+      /**
+       * @brief - The world managed by this simulation.
+       */
+      WorldShPtr m_world;
+
+      /**
+       * @brief - The commands waiting to be applied on the world.
+       */
+      CommandQueue m_commands;
+
+      /**
+       * @brief - The thread stepping the world.
+       */
+      std::thread m_thread;
+
+      /**
+       * @brief - Whether the simulation thread should stop.
+       */
+      std::atomic<bool> m_terminate;
+
+      /**
+       * @brief - The controls provided to the world. Only used by
+       *          the simulation thread.
+       */
+      controls::State m_controls;
+
+      /**
+       * @brief - Whether the world is currently stepped. Only used
+       *          by the simulation thread.
+       */
+      bool m_running;
+
+      /**
+       * @brief - The current speed multiplier. Only used by the
+       *          simulation thread.
+       */
+      unsigned m_speed;
+
+      /**
+       * @brief - The duration of simulated time (in seconds) that
+       *          was not yet processed by the world because it is
+       *          shorter than a tick.
+       */
+      float m_debt;
+
+      /**
+       * @brief - The buffers holding render states: at any time
+       *          one is read by the rendering thread, one is
+       *          written by the simulation thread and the last
+       *          one holds the latest published state.
+       */
+      std::array<RenderState, 3u> m_buffers;
+
+      /**
+       * @brief - The index of the buffer read by the rendering
+       *          thread.
+       */
+      unsigned m_front;
+
+      /**
+       * @brief - The index of the buffer written by the simulation
+       *          thread.
+       */
+      unsigned m_back;
+
+      /**
+       * @brief - The index of the buffer holding the latest state
+       *          along with the `sk_fresh` flag if it was not yet
+       *          acquired.
+       */
+      std::atomic<unsigned> m_ready;
+  };
+
+  using SimulationShPtr = std::shared_ptr<Simulation>;
+}
+
+# include "Simulation.hxx"
+
+#endif    /* SIMULATION_HH */
@@ -0,0 +1,85 @@
+#ifndef    SIMULATION_HXX
+# define   SIMULATION_HXX
+
+# include "Simulation.hh"
+
+namespace new_frontiers {
+
+  inline
+  Simulation::~Simulation() {
+    stop();
+  }
+
+  inline
+  void
+  Simulation::setControls(const controls::State& controls) {
+    post(
+      [this, controls](World& /*w*/) {
+        m_controls = controls;
+      }
+    );
+  }
+
+  inline
+  void
+  Simulation::setViewport(float xMin, float yMin, float xMax, float yMax) {
+    post(
+      [xMin, yMin, xMax, yMax](World& w) {
+        w.setViewport(xMin, yMin, xMax, yMax);
+      }
+    );
+  }
+
+  inline
+  void
+  Simulation::pause() {
+    post(
+      [this](World& /*w*/) {
+        m_running = false;
+      }
+    );
+  }
+
+  inline
+  void
+  Simulation::resume() {
+    post(
+      [this](World& /*w*/) {
+        m_running = true;
+        m_debt = 0.0f;
+      }
+    );
+  }
+
+  inline
+  void
+  Simulation::setSpeed(unsigned speed) {
+    post(
+      [this, speed](World& /*w*/) {
+        m_speed = std::max(speed, 1u);
+      }
+    );
+  }
+
+  inline
+  const RenderState&
+  Simulation::acquire() {
+    // Swap the front buffer with the ready one in case
+    // a new state was published since the last call.
+    if ((m_ready.load(std::memory_order_acquire) & sk_fresh) != 0u) {
+      unsigned ready = m_ready.exchange(m_front, std::memory_order_acq_rel);
+      m_front = ready & ~sk_fresh;
+    }
+
+    return m_buffers[m_front];
+  }
+
+  inline
+  ProfilerShPtr
+  Simulation::profiler() const noexcept {
+    return m_world->profiler();
+  }
+
+}
+
+#endif    /* SIMULATION_HXX */
@@ -3,34 +3,85 @@
 
 namespace new_frontiers {
 
+  StepInfo
+  StepInfo::fork(CounterRNG& r,
+                 std::vector<Influence>& i,
+                 std::pmr::memory_resource* a) const noexcept
+  {
+    return StepInfo{
+      xMin,
+      xMax,
+      yMin,
+      yMax,
+
+      vxMin,
+      vxMax,
+      vyMin,
+      vyMax,
+
+      r,
+
+      i,
+
+      moment,
+      elapsed,
+
+      frustum,
+
+      controls,
+
+      a
+    };
+  }
+
   void
   StepInfo::spawnBlock(BlockShPtr e) {
-    influences.push_back(std::make_shared<Influence>(influence::Type::BlockSpawn, e));
+    influences.emplace_back(influence::Type::BlockSpawn, std::move(e));
   }
 
   void
-  StepInfo::removeBlock(Block* e) {
-    influences.push_back(std::make_shared<Influence>(influence::Type::BlockRemoval, e));
+  StepInfo::removeBlock(BlockHandle e) {
+    influences.emplace_back(influence::Type::BlockRemoval, e);
+  }
+
+  void
+  StepInfo::wakeBlock(BlockHandle e) {
+    influences.emplace_back(influence::Type::BlockWakeUp, e);
   }
 
   void
   StepInfo::spawnEntity(EntityShPtr e) {
-    influences.push_back(std::make_shared<Influence>(influence::Type::EntitySpawn, e));
+    influences.emplace_back(influence::Type::EntitySpawn, std::move(e));
   }
 
   void
-  StepInfo::removeEntity(Entity* e) {
-    influences.push_back(std::make_shared<Influence>(influence::Type::EntityRemoval, e));
+  StepInfo::removeEntity(EntityHandle e) {
+    influences.emplace_back(influence::Type::EntityRemoval, e);
   }
 
   void
   StepInfo::spawnVFX(VFXShPtr e) {
-    influences.push_back(std::make_shared<Influence>(influence::Type::VFXSpawn, e));
+    influences.emplace_back(influence::Type::VFXSpawn, std::move(e));
+  }
+
+  void
+  StepInfo::removeVFX(VFXHandle e) {
+    influences.emplace_back(influence::Type::VFXRemoval, e);
+  }
+
+  void
+  StepInfo::damage(EntityHandle e, float hit) {
+    influences.emplace_back(e, hit);
+  }
+
+  void
+  StepInfo::harvest(BlockHandle d, EntityHandle m, float amount) {
+    influences.emplace_back(influence::Type::Harvest, d, m, amount);
   }
 
   void
-  StepInfo::removeVFX(VFX* e) {
-    influences.push_back(std::make_shared<Influence>(influence::Type::VFXRemoval, e));
+  StepInfo::refill(BlockHandle s, EntityHandle m, float amount) {
+    influences.emplace_back(influence::Type::Refill, s, m, amount);
   }
 
 }
@@ -3,10 +3,12 @@
 
 # include <vector>
 # include <memory>
-# include <core_utils/RNG.hh>
+# include <memory_resource>
 # include <core_utils/TimeUtils.hh>
 # include "Controls.hh"
 # include "Influence.hh"
+# include "CounterRNG.hh"
+# include "Handle.hh"
 # include <maths_utils/Point2.hh>
 
 namespace new_frontiers {
@@ -23,8 +25,6 @@ namespace new_frontiers {
 
   class Influence;
 
-  using InfluenceShPtr = std::shared_ptr<Influence>;
-
   class Locator;
 
   using LocatorShPtr = std::shared_ptr<Locator>;
@@ -39,16 +39,33 @@ namespace new_frontiers {
     float xMin, xMax;
     float yMin, yMax;
 
-    utils::RNG& rng;
+    // Area of the world currently displayed on screen, in
+    // cells. It is empty when nothing is displayed (e.g. in
+    // headless runs).
+    float vxMin, vxMax;
+    float vyMin, vyMax;
+
+    // Random stream of the element being stepped: it should
+    // be reset with the identifier of the element before its
+    // `step` method is called.
+    CounterRNG& rng;
 
-    std::vector<InfluenceShPtr>& influences;
+    std::vector<Influence>& influences;
 
+    // The simulation time: it starts at the epoch and only
+    // advances by `elapsed` at each step, whatever the wall
+    // clock says.
     utils::TimeStamp moment;
     float elapsed;
 
     LocatorShPtr frustum;
 
-    controls::State controls;
+    const controls::State& controls;
+
+    // Memory for the transient containers built while the
+    // element is stepped: it is reclaimed at the end of the
+    // step so nothing allocated from it should be kept.
+    std::pmr::memory_resource* arena;
 
     void
     clampCoord(float& x, float& y) const noexcept;
@@ -56,6 +73,30 @@ namespace new_frontiers {
     void
     clampCoord(utils::Point2f& p) const noexcept;
 
+    /**
+     * @brief - Whether the input position lies in the area of
+     *          the world currently displayed on screen.
+     * @param p - the position to check.
+     * @return - `true` if the position is visible.
+     */
+    bool
+    onScreen(const utils::Point2f& p) const noexcept;
+
+    /**
+     * @brief - Create a copy of this step information using the
+     *          input random number generator, list of influences
+     *          and arena. This allows to step several elements
+     *          concurrently.
+     * @param r - the random number generator to use.
+     * @param i - the list of influences to populate.
+     * @param a - the arena for transient containers.
+     * @return - the copy of the step information.
+     */
+    StepInfo
+    fork(CounterRNG& r,
+         std::vector<Influence>& i,
+         std::pmr::memory_resource* a) const noexcept;
+
     /**
      * @brief - Clamp the direction indicated by the input
      *          values so that they describe a valid path
@@ -76,19 +117,67 @@ namespace new_frontiers {
     spawnBlock(BlockShPtr e);
 
     void
-    removeBlock(Block* e);
+    removeBlock(BlockHandle e);
+
+    /**
+     * @brief - Request the block to be stepped at the next step
+     *          of the world, typically because it was modified
+     *          by the element being stepped.
+     * @param e - the block to wake up.
+     */
+    void
+    wakeBlock(BlockHandle e);
 
     void
     spawnEntity(EntityShPtr e);
 
     void
-    removeEntity(Entity* e);
+    removeEntity(EntityHandle e);
 
     void
     spawnVFX(VFXShPtr e);
 
     void
-    removeVFX(VFX* e);
+    removeVFX(VFXHandle e);
+
+    /**
+     * @brief - Request the entity to be hit by the specified
+     *          amount of damage. Damage dealt by all elements
+     *          during a step is applied at once at the end of
+     *          the step, and the entity is removed if it dies.
+     * @param e - the entity to hit.
+     * @param hit - the amount of damage.
+     */
+    void
+    damage(EntityHandle e, float hit);
+
+    /**
+     * @brief - Request some resources from a deposit for the mob.
+     *          The mob is expected to carry the requested amount
+     *          right away: in case the deposit cannot satisfy all
+     *          the requests made during a step it is shared among
+     *          them in proportion of what they requested and the
+     *          mobs drop the part they were refused.
+     * @param d - the deposit to harvest.
+     * @param m - the mob harvesting the deposit.
+     * @param amount - the amount of resources requested.
+     */
+    void
+    harvest(BlockHandle d, EntityHandle m, float amount);
+
+    /**
+     * @brief - Request resources to be added to (if the amount is
+     *          positive) or taken from (if it is negative) the
+     *          spawner. Resources taken heal the mob: they are
+     *          shared like the ones of a deposit once all the
+     *          resources brought during the step were added.
+     * @param s - the spawner to refill.
+     * @param m - the mob to heal, can be invalid when resources
+     *            are added.
+     * @param amount - the amount of resources to add or take.
+     */
+    void
+    refill(BlockHandle s, EntityHandle m, float amount);
   };
 
 }
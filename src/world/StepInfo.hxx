@@ -20,6 +20,12 @@ namespace new_frontiers {
     p.y() = std::min(std::max(p.y(), yMin), yMax);
   }
 
+  inline
+  bool
+  StepInfo::onScreen(const utils::Point2f& p) const noexcept {
+    return p.x() >= vxMin && p.x() <= vxMax && p.y() >= vyMin && p.y() <= vyMax;
+  }
+
   inline
   void
   StepInfo::clampPath(const utils::Point2f& s, float& xD, float& yD, float& d) const noexcept {
@@ -0,0 +1,226 @@
+
+# include "TaskGraph.hh"
+# include <thread>
+
+namespace new_frontiers {
+
+  void
+  TaskGraph::add(const std::string& name,
+                 unsigned count,
+                 unsigned reads,
+                 unsigned writes,
+                 const Job& job)
+  {
+    // Recycle the task left at this position if any so
+    // that its memory is reused.
+    unsigned id = m_count;
+    if (id == m_tasks.size()) {
+      m_tasks.push_back(Task{std::string(), 0u, 0u, 0u, Job(), std::vector<unsigned>(), 0u, 0u, 0u});
+    }
+
+    Task& t = m_tasks[id];
+    t.name = name;
+    t.count = count;
+    t.reads = reads;
+    t.writes = writes;
+    t.job = job;
+    t.successors.clear();
+    t.dependencies = 0u;
+    t.pending = 0u;
+    t.remaining = 0u;
+
+    // The task depends on any previous one with which
+    // it could conflict on the data it accesses.
+    for (unsigned prev = 0u ; prev < id ; ++prev) {
+      Task& p = m_tasks[prev];
+
+      if ((p.writes & (reads | writes)) != 0u || (p.reads & writes) != 0u) {
+        p.successors.push_back(id);
+        ++t.dependencies;
+      }
+    }
+
+    ++m_count;
+  }
+
+  void
+  TaskGraph::run(ThreadPool& pool) {
+    unsigned threads = pool.size();
+
+    while (m_queues.size() < threads) {
+      m_queues.push_back(std::make_shared<Queue>());
+    }
+
+    // Reset the progress of the tasks.
+    m_total = 0u;
+    m_done = 0u;
+    m_error = nullptr;
+
+    for (unsigned id = 0u ; id < m_count ; ++id) {
+      m_tasks[id].pending = m_tasks[id].dependencies;
+      m_tasks[id].remaining = m_tasks[id].count;
+
+      m_total += m_tasks[id].count;
+    }
+
+    // Tasks without dependencies are available right
+    // away: the other threads will steal from the
+    // first one.
+    {
+      std::unique_lock<std::mutex> guard(m_locker);
+
+      for (unsigned id = 0u ; id < m_count ; ++id) {
+        if (m_tasks[id].dependencies == 0u) {
+          release(0u, id);
+        }
+      }
+    }
+
+    pool.run(
+      threads,
+      [this](unsigned thread) {
+        process(thread);
+      }
+    );
+
+    if (m_error != nullptr) {
+      std::exception_ptr err = m_error;
+      m_error = nullptr;
+
+      std::rethrow_exception(err);
+    }
+  }
+
+  void
+  TaskGraph::process(unsigned thread) {
+    Range r{0u, 0u, 0u};
+
+    while (m_done.load() < m_total) {
+      if (!pop(thread, r) && !steal(thread, r)) {
+        // Units are still executing: wait for them to
+        // release the tasks depending on them.
+        std::this_thread::yield();
+        continue;
+      }
+
+      try {
+        m_tasks[r.task].job(r.begin);
+      }
+      catch (...) {
+        std::unique_lock<std::mutex> guard(m_locker);
+        if (m_error == nullptr) {
+          m_error = std::current_exception();
+        }
+      }
+
+      complete(thread, r.task);
+    }
+  }
+
+  bool
+  TaskGraph::pop(unsigned thread, Range& range) {
+    Queue& q = *m_queues[thread];
+    std::unique_lock<std::mutex> guard(q.locker);
+
+    if (q.ranges.empty()) {
+      return false;
+    }
+
+    Range& back = q.ranges.back();
+    range = Range{back.task, back.begin, back.begin + 1u};
+
+    ++back.begin;
+    if (back.begin >= back.end) {
+      q.ranges.pop_back();
+    }
+
+    return true;
+  }
+
+  bool
+  TaskGraph::steal(unsigned thread, Range& range) {
+    for (unsigned off = 1u ; off < m_queues.size() ; ++off) {
+      Queue& q = *m_queues[(thread + off) % m_queues.size()];
+      Range stolen{0u, 0u, 0u};
+
+      {
+        std::unique_lock<std::mutex> guard(q.locker);
+
+        if (q.ranges.empty()) {
+          continue;
+        }
+
+        // Take the second half of the oldest range, or
+        // the whole range if it is a single unit.
+        Range& front = q.ranges.front();
+        unsigned mid = front.begin + (front.end - front.begin) / 2u;
+
+        stolen = Range{front.task, mid, front.end};
+        front.end = mid;
+
+        if (front.begin >= front.end) {
+          q.ranges.pop_front();
+        }
+      }
+
+      range = Range{stolen.task, stolen.begin, stolen.begin + 1u};
+
+      if (stolen.begin + 1u < stolen.end) {
+        Queue& own = *m_queues[thread];
+        std::unique_lock<std::mutex> guard(own.locker);
+        own.ranges.push_back(Range{stolen.task, stolen.begin + 1u, stolen.end});
+      }
+
+      return true;
+    }
+
+    return false;
+  }
+
+  void
+  TaskGraph::complete(unsigned thread, unsigned task) {
+    {
+      std::unique_lock<std::mutex> guard(m_locker);
+
+      --m_tasks[task].remaining;
+      if (m_tasks[task].remaining == 0u) {
+        for (unsigned id = 0u ; id < m_tasks[task].successors.size() ; ++id) {
+          Task& s = m_tasks[m_tasks[task].successors[id]];
+
+          --s.pending;
+          if (s.pending == 0u) {
+            release(thread, m_tasks[task].successors[id]);
+          }
+        }
+      }
+    }
+
+    // Count the unit as done only once its successors
+    // are released so that no thread terminates early.
+    ++m_done;
+  }
+
+  void
+  TaskGraph::release(unsigned thread, unsigned task) {
+    Task& t = m_tasks[task];
+
+    if (t.count > 0u) {
+      Queue& q = *m_queues[thread];
+      std::unique_lock<std::mutex> guard(q.locker);
+      q.ranges.push_back(Range{task, 0u, t.count});
+
+      return;
+    }
+
+    // A task without unit is completed right away.
+    for (unsigned id = 0u ; id < t.successors.size() ; ++id) {
+      Task& s = m_tasks[t.successors[id]];
+
+      --s.pending;
+      if (s.pending == 0u) {
+        release(thread, t.successors[id]);
+      }
+    }
+  }
+
+}
@@ -0,0 +1,245 @@
+#ifndef    TASK_GRAPH_HH
+# define   TASK_GRAPH_HH
+
+# include <mutex>
+# include <deque>
+# include <atomic>
+# include <memory>
+# include <string>
+# include <vector>
+# include <exception>
+# include <functional>
+# include <core_utils/CoreObject.hh>
+# include "ThreadPool.hh"
+
+namespace new_frontiers {
+
+  namespace task {
+
+    /**
+     * @brief - The data of the world that can be accessed by
+     *          a task. Values can be combined to describe all
+     *          the data read or written by a task.
+     */
+    enum Data {
+      None = 0u,
+      Blocks = 1u << 0,
+      Entities = 1u << 1,
+      Effects = 1u << 2,
+      Colonies = 1u << 3
+    };
+
+  }
+
+  /**
+   * @brief - A graph of tasks to execute on a thread pool. Each
+   *          task is split in a number of independent units and
+   *          declares the data it reads and writes: a task then
+   *          depends on all the tasks added before it that write
+   *          data it accesses or that read data it writes. This
+   *          guarantees that the result is the same as executing
+   *          the tasks in sequence, in the order they were added,
+   *          while independent tasks run concurrently.
+   *          Each thread processes units from its own list and
+   *          steals some from the other threads when it runs out
+   *          of work.
+   */
+  class TaskGraph: public utils::CoreObject {
+    public:
+
+      /**
+       * @brief - Convenience define representing the job of a
+       *          task. The job receives the index of the unit to
+       *          process within the task.
+       */
+      using Job = std::function<void(unsigned)>;
+
+      /**
+       * @brief - Create a new empty graph.
+       */
+      TaskGraph();
+
+      /**
+       * @brief - Desctruction of the object.
+       */
+      ~TaskGraph() = default;
+
+      /**
+       * @brief - Register a new task in the graph.
+       * @param name - the name of the task, used for display.
+       * @param count - the number of units of the task. A task
+       *                with no unit is allowed and completes as
+       *                soon as its dependencies are met.
+       * @param reads - a combination of `task::Data` values that
+       *                are read by the task.
+       * @param writes - a combination of `task::Data` values that
+       *                 are written by the task.
+       * @param job - the job to execute for each unit.
+       */
+      void
+      add(const std::string& name,
+          unsigned count,
+          unsigned reads,
+          unsigned writes,
+          const Job& job);
+
+      /**
+       * @brief - Execute all the tasks of the graph on the threads
+       *          of the pool. The method blocks until all of them
+       *          have been processed.
+       *          In case one of the units raises an exception, it
+       *          is transmitted to the caller once all the tasks
+       *          have been processed.
+       * @param pool - the pool to use to execute the tasks.
+       */
+      void
+      run(ThreadPool& pool);
+
+      /**
+       * @brief - Remove all the tasks from the graph so that it
+       *          can be reused. The memory used by the tasks is
+       *          kept for the ones added next.
+       */
+      void
+      clear() noexcept;
+
+    private:
+
+      /**
+       * @brief - Convenience structure describing a task of the
+       *          graph.
+       */
+      struct Task {
+        std::string name;
+        unsigned count;
+        unsigned reads;
+        unsigned writes;
+        Job job;
+
+        // The tasks which depend on this one.
+        std::vector<unsigned> successors;
+
+        // The number of tasks this one depends on.
+        unsigned dependencies;
+
+        // The number of dependencies not yet completed and
+        // the number of units not yet executed during a run.
+        unsigned pending;
+        unsigned remaining;
+      };
+
+      /**
+       * @brief - A range of units of a task ready to be executed.
+       */
+      struct Range {
+        unsigned task;
+        unsigned begin;
+        unsigned end;
+      };
+
+      /**
+       * @brief - The units available to a thread: the owner picks
+       *          them from the back while other threads steal from
+       *          the front.
+       */
+      struct Queue {
+        std::mutex locker;
+        std::deque<Range> ranges;
+      };
+
+      using QueueShPtr = std::shared_ptr<Queue>;
+
+      /**
+       * @brief - Main loop for a thread: executes units until all
+       *          the tasks of the graph are completed.
+       * @param thread - the index of the queue of the thread.
+       */
+      void
+      process(unsigned thread);
+
+      /**
+       * @brief - Fetch a unit from the queue of the thread.
+       * @param thread - the index of the queue of the thread.
+       * @param range - output argument receiving the unit.
+       * @return - `false` if the queue is empty.
+       */
+      bool
+      pop(unsigned thread, Range& range);
+
+      /**
+       * @brief - Steal some units from the queue of other threads.
+       *          Half of the first range found is taken: one unit
+       *          is returned and the rest is appended to the queue
+       *          of the thread.
+       * @param thread - the index of the queue of the thread.
+       * @param range - output argument receiving the unit.
+       * @return - `false` if no unit could be stolen.
+       */
+      bool
+      steal(unsigned thread, Range& range);
+
+      /**
+       * @brief - Register that a unit of a task was executed. When
+       *          it is the last one, the tasks depending on it are
+       *          made available in the queue of the thread if all
+       *          of their dependencies are completed.
+       * @param thread - the index of the queue of the thread.
+       * @param task - the task of the unit.
+       */
+      void
+      complete(unsigned thread, unsigned task);
+
+      /**
+       * @brief - Make the units of a task available in the queue
+       *          of the thread. A task without unit is directly
+       *          completed. Assumes that `m_locker` is held.
+       * @param thread - the index of the queue of the thread.
+       * @param task - the task to release.
+       */
+      void
+      release(unsigned thread, unsigned task);
+
+    private:
+
+      /**
+       * @brief - The tasks of the graph in the order they were
+       *          added. Only the first `m_count` ones are part of
+       *          the graph: the others are left from a previous
+       *          use and are recycled by `add`.
+       */
+      std::vector<Task> m_tasks;
+      unsigned m_count;
+
+      /**
+       * @brief - The queue of units of each thread.
+       */
+      std::vector<QueueShPtr> m_queues;
+
+      /**
+       * @brief - Protects the progress of tasks and the error
+       *          raised during a run.
+       */
+      std::mutex m_locker;
+
+      /**
+       * @brief - The total number of units to execute in a run.
+       */
+      unsigned m_total;
+
+      /**
+       * @brief - The number of units executed so far in a run.
+       */
+      std::atomic<unsigned> m_done;
+
+      /**
+       * @brief - The first error raised by a unit during a run if
+       *          any.
+       */
+      std::exception_ptr m_error;
+  };
+
+}
+
+# include "TaskGraph.hxx"
+
+#endif    /* TASK_GRAPH_HH */
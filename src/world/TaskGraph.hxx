@@ -0,0 +1,32 @@
+#ifndef    TASK_GRAPH_HXX
+# define   TASK_GRAPH_HXX
+
+# include "TaskGraph.hh"
+
+namespace new_frontiers {
+
+  inline
+  TaskGraph::TaskGraph():
+    utils::CoreObject("graph"),
+
+    m_tasks(),
+    m_count(0u),
+    m_queues(),
+
+    m_locker(),
+    m_total(0u),
+    m_done(0u),
+    m_error(nullptr)
+  {
+    setService("threads");
+  }
+
+  inline
+  void
+  TaskGraph::clear() noexcept {
+    m_count = 0u;
+  }
+
+}
+
+#endif    /* TASK_GRAPH_HXX */
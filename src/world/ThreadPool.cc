@@ -0,0 +1,160 @@
+
+# include "ThreadPool.hh"
+# include "Logging.hh"
+
+namespace new_frontiers {
+
+  ThreadPool::ThreadPool(unsigned threads):
+    utils::CoreObject("pool"),
+
+    m_locker(),
+    m_wakeUp(),
+    m_done(),
+
+    m_job(nullptr),
+    m_count(0u),
+    m_next(0u),
+    m_batch(0u),
+    m_active(0u),
+    m_error(nullptr),
+
+    m_terminate(false),
+
+    m_workers()
+  {
+    setService("threads");
+
+    // The calling thread always participates to the
+    // processing of a batch so we only need to create
+    // one less worker than requested.
+    unsigned count = std::max(threads, 1u) - 1u;
+
+    for (unsigned id = 0u ; id < count ; ++id) {
+      m_workers.emplace_back(&ThreadPool::loop, this);
+    }
+
+    NF_VERBOSE("Created pool with " + std::to_string(size()) + " thread(s)");
+  }
+
+  ThreadPool::~ThreadPool() {
+    {
+      std::unique_lock<std::mutex> guard(m_locker);
+      m_terminate = true;
+    }
+
+    m_wakeUp.notify_all();
+
+    for (unsigned id = 0u ; id < m_workers.size() ; ++id) {
+      m_workers[id].join();
+    }
+  }
+
+  void
+  ThreadPool::run(unsigned count, const Job& job) {
+    // In case there's no worker we can directly execute
+    // the tasks: this avoids any synchronization.
+    if (m_workers.empty()) {
+      for (unsigned id = 0u ; id < count ; ++id) {
+        job(id);
+      }
+
+      return;
+    }
+
+    // Publish the batch and wake up the workers.
+    {
+      std::unique_lock<std::mutex> guard(m_locker);
+
+      m_job = &job;
+      m_count = count;
+      m_next = 0u;
+      m_error = nullptr;
+
+      ++m_batch;
+    }
+
+    m_wakeUp.notify_all();
+
+    // Help processing the batch.
+    process(&job, count);
+
+    // Wait for all the workers to be done: as we also
+    // processed tasks until none was left, this means
+    // that all of them have been executed.
+    std::exception_ptr err = nullptr;
+    {
+      std::unique_lock<std::mutex> guard(m_locker);
+      m_done.wait(guard, [this]() { return m_active == 0u; });
+
+      m_job = nullptr;
+      m_count = 0u;
+
+      err = m_error;
+      m_error = nullptr;
+    }
+
+    if (err != nullptr) {
+      std::rethrow_exception(err);
+    }
+  }
+
+  void
+  ThreadPool::loop() {
+    unsigned seen = 0u;
+
+    while (true) {
+      const Job* job = nullptr;
+      unsigned count = 0u;
+
+      {
+        std::unique_lock<std::mutex> guard(m_locker);
+        m_wakeUp.wait(guard, [this, &seen]() { return m_terminate || m_batch != seen; });
+
+        if (m_terminate) {
+          return;
+        }
+
+        // Register as working on this batch: this will
+        // prevent the calling thread to return before we
+        // are done with the tasks we picked.
+        seen = m_batch;
+        job = m_job;
+        count = m_count;
+        ++m_active;
+      }
+
+      // In case we woke up after the batch was already
+      // completed there's nothing left to do.
+      if (job != nullptr) {
+        process(job, count);
+      }
+
+      {
+        std::unique_lock<std::mutex> guard(m_locker);
+        --m_active;
+      }
+
+      m_done.notify_all();
+    }
+  }
+
+  void
+  ThreadPool::process(const Job* job, unsigned count) {
+    unsigned id = m_next.fetch_add(1u);
+
+    while (id < count) {
+      try {
+        (*job)(id);
+      }
+      catch (...) {
+        std::unique_lock<std::mutex> guard(m_locker);
+        if (m_error == nullptr) {
+          m_error = std::current_exception();
+        }
+      }
+
+      id = m_next.fetch_add(1u);
+    }
+  }
+
+}
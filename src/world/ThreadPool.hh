@@ -0,0 +1,160 @@
+#ifndef    THREAD_POOL_HH
+# define   THREAD_POOL_HH
+
+# include <mutex>
+# include <atomic>
+# include <memory>
+# include <thread>
+# include <vector>
+# include <exception>
+# include <functional>
+# include <condition_variable>
+# include <core_utils/CoreObject.hh>
+
+namespace new_frontiers {
+
+  class ThreadPool: public utils::CoreObject {
+    public:
+
+      /**
+       * @brief - Convenience define representing a job that
+       *          can be executed by the pool. The job receives
+       *          the index of the task to process within the
+       *          batch submitted to the pool.
+       */
+      using Job = std::function<void(unsigned)>;
+
+      /**
+       * @brief - Create a new pool with the specified number of
+       *          threads. Note that the thread calling `run` is
+       *          counted as one of them: a pool with a single
+       *          thread does not create any worker and executes
+       *          all the tasks inline.
+       * @param threads - the number of threads to use to process
+       *                  the tasks. A value of `0` is interpreted
+       *                  as `1`.
+       */
+      ThreadPool(unsigned threads);
+
+      /**
+       * @brief - Desctruction of the object. Terminates all the
+       *          workers and wait for them to exit.
+       */
+      ~ThreadPool();
+
+      /**
+       * @brief - Returns the number of threads used by this pool
+       *          to process tasks, including the calling thread.
+       * @return - the number of threads of the pool.
+       */
+      unsigned
+      size() const noexcept;
+
+      /**
+       * @brief - Execute the input job for each index in the range
+       *          `[0; count)`, spreading the tasks on all threads
+       *          of the pool. The method blocks until all tasks
+       *          have been processed.
+       *          No guarantee is made on the order in which tasks
+       *          are executed nor on the thread executing them: a
+       *          job should only rely on its index to decide which
+       *          data it processes.
+       *          In case one of the task raises an exception, it
+       *          is transmitted to the caller once all the tasks
+       *          have been processed.
+       * @param count - the number of tasks to execute.
+       * @param job - the job to execute for each task.
+       */
+      void
+      run(unsigned count, const Job& job);
+
+    private:
+
+      /**
+       * @brief - Main loop for a worker thread: waits for a batch
+       *          to be submitted and then helps processing it.
+       */
+      void
+      loop();
+
+      /**
+       * @brief - Used to fetch and execute tasks from the current
+       *          batch until all of them have been picked.
+       * @param job - the job to execute.
+       * @param count - the number of tasks in the batch.
+       */
+      void
+      process(const Job* job, unsigned count);
+
+    private:
+
+      /**
+       * @brief - Protects the internal state of the batch which
+       *          is shared between the calling thread and the
+       *          workers.
+       */
+      std::mutex m_locker;
+
+      /**
+       * @brief - Used to notify workers that a new batch is ready
+       *          or that they should terminate.
+       */
+      std::condition_variable m_wakeUp;
+
+      /**
+       * @brief - Used by the workers to notify the calling thread
+       *          that they are done processing the current batch.
+       */
+      std::condition_variable m_done;
+
+      /**
+       * @brief - The job describing the current batch. Only valid
+       *          during a call to `run`.
+       */
+      const Job* m_job;
+
+      /**
+       * @brief - The number of tasks in the current batch.
+       */
+      unsigned m_count;
+
+      /**
+       * @brief - The index of the next task to pick in the batch.
+       */
+      std::atomic<unsigned> m_next;
+
+      /**
+       * @brief - An identifier of the current batch, allowing the
+       *          workers to detect that new tasks are available.
+       */
+      unsigned m_batch;
+
+      /**
+       * @brief - The number of workers currently processing tasks
+       *          of the batch.
+       */
+      unsigned m_active;
+
+      /**
+       * @brief - The first error raised by a task of the current
+       *          batch if any.
+       */
+      std::exception_ptr m_error;
+
+      /**
+       * @brief - Whether the workers should terminate.
+       */
+      bool m_terminate;
+
+      /**
+       * @brief - The worker threads of the pool.
+       */
+      std::vector<std::thread> m_workers;
+  };
+
+  using ThreadPoolShPtr = std::shared_ptr<ThreadPool>;
+}
+
+# include "ThreadPool.hxx"
+
+#endif    /* THREAD_POOL_HH */
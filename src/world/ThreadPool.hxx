@@ -0,0 +1,16 @@
+#ifndef    THREAD_POOL_HXX
+# define   THREAD_POOL_HXX
+
+# include "ThreadPool.hh"
+
+namespace new_frontiers {
+
+  inline
+  unsigned
+  ThreadPool::size() const noexcept {
+    return m_workers.size() + 1u;
+  }
+
+}
+
+#endif    /* THREAD_POOL_HXX */
@@ -0,0 +1,174 @@
+
+# include "Trace.hh"
+# include <fstream>
+# include <iomanip>
+
+namespace new_frontiers {
+  namespace trace {
+
+    const unsigned Tracer::sk_maxEvents = 1u << 20;
+
+    Tracer&
+    Tracer::instance() noexcept {
+      static Tracer tracer;
+      return tracer;
+    }
+
+    Tracer::Tracer():
+      utils::CoreObject("tracer"),
+
+      m_locker(),
+      m_active(false),
+      m_origin(0),
+      m_file(),
+      m_buffers(),
+      m_dropped(0u)
+    {
+      setService("trace");
+    }
+
+    Tracer::~Tracer() {
+      stop();
+    }
+
+    void
+    Tracer::start(const std::string& file) {
+      stop();
+
+      std::lock_guard<std::mutex> guard(m_locker);
+
+# ifndef NF_TRACE
+      warn(
+        "Starting capture to \"" + file + "\" while zones are not compiled in, "
+        "rebuild with NEW_FRONTIERS_TRACE to record events"
+      );
+# endif
+
+      // Discard events of zones which ended after the
+      // previous capture was stopped.
+      for (unsigned id = 0u ; id < m_buffers.size() ; ++id) {
+        std::lock_guard<std::mutex> bg(m_buffers[id]->locker);
+        m_buffers[id]->events.clear();
+      }
+
+      m_file = file;
+      m_dropped = 0u;
+      m_origin.store(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()
+        ).count(),
+        std::memory_order_relaxed
+      );
+
+      m_active = true;
+
+      info("Capturing trace to \"" + m_file + "\"");
+    }
+
+    void
+    Tracer::stop() {
+      std::lock_guard<std::mutex> guard(m_locker);
+
+      if (!m_active) {
+        return;
+      }
+
+      m_active = false;
+      flush();
+
+      if (m_dropped > 0u) {
+        warn("Dropped " + std::to_string(m_dropped) + " event(s) while capturing trace");
+      }
+
+      info("Saved trace to \"" + m_file + "\"");
+    }
+
+    void
+    Tracer::record(const Event& e) noexcept {
+      Buffer& b = buffer();
+      std::lock_guard<std::mutex> guard(b.locker);
+
+      if (b.events.size() >= sk_maxEvents) {
+        ++m_dropped;
+        return;
+      }
+
+      b.events.push_back(e);
+    }
+
+    Buffer&
+    Tracer::buffer() {
+      // Buffers are never released so that the threads can
+      // keep a reference to theirs.
+      thread_local Buffer* local = nullptr;
+
+      if (local == nullptr) {
+        std::lock_guard<std::mutex> guard(m_locker);
+
+        BufferShPtr b = std::make_shared<Buffer>();
+        b->thread = m_buffers.size();
+
+        m_buffers.push_back(b);
+        local = b.get();
+      }
+
+      return *local;
+    }
+
+    void
+    Tracer::flush() {
+      std::ofstream out(m_file.c_str(), std::ios::out | std::ios::trunc);
+      if (!out.good()) {
+        warn("Failed to open \"" + m_file + "\" to save trace");
+
+        for (unsigned id = 0u ; id < m_buffers.size() ; ++id) {
+          std::lock_guard<std::mutex> bg(m_buffers[id]->locker);
+          m_buffers[id]->events.clear();
+        }
+
+        return;
+      }
+
+      out << std::fixed << std::setprecision(3);
+      out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+      bool first = true;
+
+      for (unsigned id = 0u ; id < m_buffers.size() ; ++id) {
+        Buffer& b = *m_buffers[id];
+        std::lock_guard<std::mutex> bg(b.locker);
+
+        // Name the thread in the viewer.
+        out << (first ? "" : ",") << "\n"
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b.thread
+            << ",\"args\":{\"name\":\"thread " << b.thread << "\"}}";
+        first = false;
+
+        // Timestamps are expressed in microseconds.
+        for (unsigned e = 0u ; e < b.events.size() ; ++e) {
+          const Event& ev = b.events[e];
+
+          out << ",\n"
+              << "{\"name\":\"" << ev.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << b.thread
+              << ",\"ts\":" << ev.start / 1000.0
+              << ",\"dur\":" << ev.duration / 1000.0;
+
+          if (ev.keys[0] != nullptr) {
+            out << ",\"args\":{\"" << ev.keys[0] << "\":" << ev.values[0];
+            if (ev.keys[1] != nullptr) {
+              out << ",\"" << ev.keys[1] << "\":" << ev.values[1];
+            }
+            out << "}";
+          }
+
+          out << "}";
+        }
+
+        b.events.clear();
+      }
+
+      out << "\n]}\n";
+    }
+
+  }
+}
@@ -0,0 +1,267 @@
+#ifndef    TRACE_HH
+# define   TRACE_HH
+
+# include <mutex>
+# include <atomic>
+# include <chrono>
+# include <memory>
+# include <string>
+# include <vector>
+# include <cstdint>
+# include <core_utils/CoreObject.hh>
+
+namespace new_frontiers {
+  namespace trace {
+
+    /**
+     * @brief - Describes an event captured by the tracer: a
+     *          named zone of code with its start time and its
+     *          duration, along with up to two integer arguments.
+     *          Names are expected to be string literals so that
+     *          recording an event does not need an allocation.
+     */
+    struct Event {
+      const char* name;
+
+      std::int64_t start;
+      std::int64_t duration;
+
+      const char* keys[2];
+      std::int64_t values[2];
+    };
+
+    /**
+     * @brief - The events captured by a single thread. Each
+     *          thread writes in its own buffer so that threads
+     *          do not contend with each other.
+     */
+    struct Buffer {
+      unsigned thread;
+
+      std::mutex locker;
+      std::vector<Event> events;
+    };
+
+    using BufferShPtr = std::shared_ptr<Buffer>;
+
+    /**
+     * @brief - Collects the zones executed by any thread while a
+     *          capture is running and writes them into a file
+     *          using the trace event format which can be loaded
+     *          in `chrome://tracing` or Perfetto.
+     *          Zones are only compiled in when `NF_TRACE` is
+     *          defined: otherwise the macros below expand to
+     *          nothing and the tracer never receives events.
+     */
+    class Tracer: public utils::CoreObject {
+      public:
+
+        /**
+         * @brief - Retrieve the tracer used by the application.
+         * @return - the tracer.
+         */
+        static
+        Tracer&
+        instance() noexcept;
+
+        /**
+         * @brief - Desctruction of the object. Any running capture
+         *          is written to its file.
+         */
+        ~Tracer();
+
+        /**
+         * @brief - Whether a capture is currently running. Zones
+         *          are not measured otherwise.
+         * @return - `true` if events are captured.
+         */
+        bool
+        active() const noexcept;
+
+        /**
+         * @brief - Start capturing events which will be written in
+         *          the specified file when the capture is stopped.
+         *          Any previous capture is stopped.
+         * @param file - the name of the file to write.
+         */
+        void
+        start(const std::string& file);
+
+        /**
+         * @brief - Stop the current capture if any and write the
+         *          events captured so far to its file.
+         */
+        void
+        stop();
+
+        /**
+         * @brief - Register an event for the calling thread. The
+         *          event is dropped in case the buffer of the
+         *          thread is full.
+         * @param e - the event to register.
+         */
+        void
+        record(const Event& e) noexcept;
+
+        /**
+         * @brief - The number of nanoseconds elapsed since the start
+         *          of the capture.
+         * @return - the current time of the capture.
+         */
+        std::int64_t
+        now() const noexcept;
+
+      private:
+
+        /**
+         * @brief - Create a new tracer with no capture running.
+         */
+        Tracer();
+
+        /**
+         * @brief - Retrieve the buffer of the calling thread,
+         *          creating it if needed.
+         * @return - the buffer of the thread.
+         */
+        Buffer&
+        buffer();
+
+        /**
+         * @brief - Write the events of all buffers to the file of
+         *          the capture and clear them. Assumes that the
+         *          locker is already acquired.
+         */
+        void
+        flush();
+
+      private:
+
+        /**
+         * @brief - The maximum number of events kept for a thread
+         *          during a capture.
+         */
+        static const unsigned sk_maxEvents;
+
+        /**
+         * @brief - Protects the list of buffers and the capture.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - Whether a capture is running.
+         */
+        std::atomic_bool m_active;
+
+        /**
+         * @brief - The reference time of the capture, in nanoseconds
+         *          since the epoch of the steady clock. It is read by
+         *          the threads running zones while a new capture can
+         *          be started, hence the atomic.
+         */
+        std::atomic_int64_t m_origin;
+
+        /**
+         * @brief - The file into which the capture is written.
+         */
+        std::string m_file;
+
+        /**
+         * @brief - The buffers of the threads which recorded some
+         *          events.
+         */
+        std::vector<BufferShPtr> m_buffers;
+
+        /**
+         * @brief - The number of events dropped during the capture
+         *          because a buffer was full.
+         */
+        std::atomic_uint m_dropped;
+    };
+
+    /**
+     * @brief - Measures the time spent in a scope and registers it
+     *          as an event of the tracer when the scope is left.
+     *          Nothing is measured if no capture is running when
+     *          the zone is entered.
+     */
+    class Zone {
+      public:
+
+        /**
+         * @brief - Enter a new zone.
+         * @param name - the name of the zone, should be a string
+         *               literal.
+         */
+        explicit
+        Zone(const char* name) noexcept;
+
+        /**
+         * @brief - Enter a new zone with an argument.
+         * @param name - the name of the zone.
+         * @param key - the name of the argument.
+         * @param value - the value of the argument.
+         */
+        Zone(const char* name, const char* key, std::int64_t value) noexcept;
+
+        /**
+         * @brief - Leave the zone and register it.
+         */
+        ~Zone();
+
+        /**
+         * @brief - Attach an argument to the zone. Only the first
+         *          two arguments are kept.
+         * @param key - the name of the argument.
+         * @param value - the value of the argument.
+         */
+        void
+        arg(const char* key, std::int64_t value) noexcept;
+
+      private:
+
+        /**
+         * @brief - Whether the zone is measured.
+         */
+        bool m_active;
+
+        /**
+         * @brief - The event describing the zone.
+         */
+        Event m_event;
+    };
+
+  }
+}
+
+# include "Trace.hxx"
+
+/**
+ * @brief - Macros to instrument the code with zones. When the
+ *          `NF_TRACE` flag is not defined they expand to nothing
+ *          and their arguments are not evaluated.
+ *          - `TRACE_ZONE(name)` measures the enclosing scope.
+ *          - `TRACE_NAMED_ZONE(var, name)` measures the enclosing
+ *            scope in a zone named `var` which can be given some
+ *            arguments with `TRACE_ARG(var, key, value)`.
+ *          - `TRACE_ZONE_ARG(var, name, key, value)` is the same
+ *            as the above with an initial argument.
+ */
+# ifdef NF_TRACE
+#  define NF_TRACE_CONCAT_IMPL(a, b) a##b
+#  define NF_TRACE_CONCAT(a, b) NF_TRACE_CONCAT_IMPL(a, b)
+#  define TRACE_ZONE(name) \
+  ::new_frontiers::trace::Zone NF_TRACE_CONCAT(nf_trace_zone_, __LINE__)(name)
+#  define TRACE_NAMED_ZONE(var, name) \
+  ::new_frontiers::trace::Zone var(name)
+#  define TRACE_ZONE_ARG(var, name, key, value) \
+  ::new_frontiers::trace::Zone var(name, key, static_cast<std::int64_t>(value))
+#  define TRACE_ARG(var, key, value) \
+  var.arg(key, static_cast<std::int64_t>(value))
+# else
+#  define TRACE_ZONE(name)
+#  define TRACE_NAMED_ZONE(var, name)
+#  define TRACE_ZONE_ARG(var, name, key, value)
+#  define TRACE_ARG(var, key, value)
+# endif
+
+#endif    /* TRACE_HH */
@@ -0,0 +1,70 @@
+#ifndef    TRACE_HXX
+# define   TRACE_HXX
+
+# include "Trace.hh"
+
+namespace new_frontiers {
+  namespace trace {
+
+    inline
+    bool
+    Tracer::active() const noexcept {
+      return m_active.load(std::memory_order_acquire);
+    }
+
+    inline
+    std::int64_t
+    Tracer::now() const noexcept {
+      std::int64_t t = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+      ).count();
+
+      return t - m_origin.load(std::memory_order_relaxed);
+    }
+
+    inline
+    Zone::Zone(const char* name) noexcept:
+      m_active(Tracer::instance().active()),
+      m_event{name, 0, 0, {nullptr, nullptr}, {0, 0}}
+    {
+      if (m_active) {
+        m_event.start = Tracer::instance().now();
+      }
+    }
+
+    inline
+    Zone::Zone(const char* name, const char* key, std::int64_t value) noexcept:
+      Zone(name)
+    {
+      arg(key, value);
+    }
+
+    inline
+    Zone::~Zone() {
+      if (!m_active) {
+        return;
+      }
+
+      Tracer& t = Tracer::instance();
+      m_event.duration = t.now() - m_event.start;
+
+      t.record(m_event);
+    }
+
+    inline
+    void
+    Zone::arg(const char* key, std::int64_t value) noexcept {
+      for (unsigned id = 0u ; id < 2u ; ++id) {
+        if (m_event.keys[id] == nullptr) {
+          m_event.keys[id] = key;
+          m_event.values[id] = value;
+
+          return;
+        }
+      }
+    }
+
+  }
+}
+
+#endif    /* TRACE_HXX */
@@ -0,0 +1,101 @@
+
+# include "WakeUpQueue.hh"
+# include <algorithm>
+
+namespace new_frontiers {
+
+  void
+  WakeUpQueue::insert(WorldElementShPtr element, const utils::TimeStamp& moment) {
+    if (element->m_alarm == 0u) {
+      ++m_count;
+
+      // Make room for the most entries the lists can
+      // hold before they are compacted so that steps
+      // do not need to grow them.
+      if (m_asleep.capacity() < 2u * m_count + 65u) {
+        m_awake.reserve(4u * m_count);
+        m_asleep.reserve(4u * m_count + 65u);
+      }
+    }
+
+    element->m_stepped = moment;
+
+    schedule(element, moment);
+  }
+
+  void
+  WakeUpQueue::schedule(WorldElementShPtr element, const utils::TimeStamp& next) {
+    std::uint64_t alarm = arm(*element);
+
+    // Elements stepped at each step do not need to go
+    // through the heap.
+    if (next <= element->m_stepped) {
+      m_awake.push_back(Entry{next, element->getId(), alarm, element});
+      return;
+    }
+
+    m_asleep.push_back(Entry{next, element->getId(), alarm, element});
+    std::push_heap(m_asleep.begin(), m_asleep.end(), &WakeUpQueue::later);
+
+    compact();
+  }
+
+  void
+  WakeUpQueue::wake(WorldElementShPtr element) {
+    // Elements which are not scheduled (for example
+    // because they were removed) stay that way.
+    if (element->m_alarm == 0u) {
+      return;
+    }
+
+    // The entry of the element is made outdated by
+    // assigning a new alarm.
+    std::uint64_t alarm = arm(*element);
+    m_awake.push_back(Entry{element->m_stepped, element->getId(), alarm, element});
+  }
+
+  void
+  WakeUpQueue::due(const utils::TimeStamp& moment, std::vector<Alarm>& alarms) {
+    auto emit = [&moment, &alarms](Entry& e) {
+      if (e.alarm != e.element->m_alarm) {
+        return;
+      }
+
+      float elapsed = std::chrono::duration<float>(moment - e.element->m_stepped).count();
+      e.element->m_stepped = moment;
+
+      alarms.push_back(Alarm{std::move(e.element), elapsed});
+    };
+
+    for (unsigned id = 0u ; id < m_awake.size() ; ++id) {
+      emit(m_awake[id]);
+    }
+    m_awake.clear();
+
+    while (!m_asleep.empty() && m_asleep.front().moment <= moment) {
+      std::pop_heap(m_asleep.begin(), m_asleep.end(), &WakeUpQueue::later);
+      emit(m_asleep.back());
+      m_asleep.pop_back();
+    }
+  }
+
+  void
+  WakeUpQueue::compact() {
+    // Outdated entries are only discarded when they
+    // reach the front of the heap: this is a problem
+    // for the elements sleeping forever.
+    if (m_asleep.size() <= 2u * m_count + 64u) {
+      return;
+    }
+
+    std::erase_if(
+      m_asleep,
+      [](const Entry& e) {
+        return e.alarm != e.element->m_alarm;
+      }
+    );
+
+    std::make_heap(m_asleep.begin(), m_asleep.end(), &WakeUpQueue::later);
+  }
+
+}
@@ -0,0 +1,162 @@
+#ifndef    WAKE_UP_QUEUE_HH
+# define   WAKE_UP_QUEUE_HH
+
+# include <memory>
+# include <vector>
+# include <cstdint>
+# include <core_utils/TimeUtils.hh>
+# include "WorldElement.hh"
+
+namespace new_frontiers {
+
+  /**
+   * @brief - Schedules the steps of a set of world elements. Each
+   *          element registers the next moment at which it needs
+   *          to be stepped (see `WorldElement::nextWakeUp`): the
+   *          elements asking to be stepped at each step are kept
+   *          in a plain list while the others are sleeping in a
+   *          priority queue ordered by wake-up time. Elements
+   *          that sleep indefinitely thus cost nothing.
+   *          The order in which due elements are returned only
+   *          depends on the sequence of operations applied on
+   *          the queue, which keeps the simulation deterministic.
+   */
+  class WakeUpQueue {
+    public:
+
+      /**
+       * @brief - Convenience structure describing an element due
+       *          to be stepped along with the duration since it
+       *          was last stepped.
+       */
+      struct Alarm {
+        WorldElementShPtr element;
+        float elapsed;
+      };
+
+      /**
+       * @brief - Create a new empty queue.
+       */
+      WakeUpQueue();
+
+      /**
+       * @brief - Register a new element in the queue, considering
+       *          that it was last stepped at `moment`: it will be
+       *          due at the next call to `due`.
+       * @param element - the element to register.
+       * @param moment - the current simulation time.
+       */
+      void
+      insert(WorldElementShPtr element, const utils::TimeStamp& moment);
+
+      /**
+       * @brief - Remove the element from the queue. Nothing
+       *          happens if the element is not registered.
+       * @param element - the element to remove.
+       */
+      void
+      remove(WorldElement& element) noexcept;
+
+      /**
+       * @brief - Schedule the next step of an element returned by
+       *          `due` at the specified moment. A moment not later
+       *          than the last step of the element means that it
+       *          is due at the next call to `due`.
+       * @param element - the element to schedule.
+       * @param next - the moment at which the element should be
+       *               stepped.
+       */
+      void
+      schedule(WorldElementShPtr element, const utils::TimeStamp& next);
+
+      /**
+       * @brief - Make the element due at the next call to `due`
+       *          no matter the moment it was scheduled for. This
+       *          is used when the element is modified by another
+       *          one. Nothing happens if the element is not in
+       *          the queue.
+       * @param element - the element to wake up.
+       */
+      void
+      wake(WorldElementShPtr element);
+
+      /**
+       * @brief - Extract all the elements due at `moment`. They
+       *          are removed from the queue and are expected to
+       *          be rescheduled with `schedule` once stepped.
+       *          Elements stepped at each step come first, then
+       *          the ones that were sleeping by wake-up time.
+       * @param moment - the current simulation time.
+       * @param alarms - output vector receiving the due elements.
+       *                 It is not cleared.
+       */
+      void
+      due(const utils::TimeStamp& moment, std::vector<Alarm>& alarms);
+
+    private:
+
+      /**
+       * @brief - An entry of the queue: it is outdated when the
+       *          alarm does not match the one registered in the
+       *          element anymore.
+       */
+      struct Entry {
+        utils::TimeStamp moment;
+        std::uint64_t id;
+        std::uint64_t alarm;
+        WorldElementShPtr element;
+      };
+
+      /**
+       * @brief - Comparison of entries used to maintain the heap
+       *          of sleeping elements: the earliest wake-up time
+       *          comes first, ties are broken by identifier.
+       */
+      static bool
+      later(const Entry& lhs, const Entry& rhs) noexcept;
+
+      /**
+       * @brief - Assign a new alarm to the element, which makes
+       *          any entry registered for it outdated.
+       * @param element - the element to assign an alarm to.
+       * @return - the new alarm.
+       */
+      std::uint64_t
+      arm(WorldElement& element) noexcept;
+
+      /**
+       * @brief - Remove outdated entries from the heap when they
+       *          represent the majority of it.
+       */
+      void
+      compact();
+
+    private:
+
+      /**
+       * @brief - The last alarm assigned to an element.
+       */
+      std::uint64_t m_lastAlarm;
+
+      /**
+       * @brief - The number of elements registered in the queue.
+       */
+      std::size_t m_count;
+
+      /**
+       * @brief - The elements to step at the next call to `due`.
+       */
+      std::vector<Entry> m_awake;
+
+      /**
+       * @brief - The sleeping elements, arranged as a heap with
+       *          the earliest wake-up time at the front.
+       */
+      std::vector<Entry> m_asleep;
+  };
+
+}
+
+# include "WakeUpQueue.hxx"
+
+#endif    /* WAKE_UP_QUEUE_HH */
@@ -0,0 +1,49 @@
+#ifndef    WAKE_UP_QUEUE_HXX
+# define   WAKE_UP_QUEUE_HXX
+
+# include "WakeUpQueue.hh"
+
+namespace new_frontiers {
+
+  inline
+  WakeUpQueue::WakeUpQueue():
+    m_lastAlarm(0u),
+    m_count(0u),
+
+    m_awake(),
+    m_asleep()
+  {}
+
+  inline
+  void
+  WakeUpQueue::remove(WorldElement& element) noexcept {
+    if (element.m_alarm == 0u) {
+      return;
+    }
+
+    // Entries registered for this element will be
+    // discarded when they are reached.
+    element.m_alarm = 0u;
+    --m_count;
+  }
+
+  inline
+  bool
+  WakeUpQueue::later(const Entry& lhs, const Entry& rhs) noexcept {
+    if (lhs.moment != rhs.moment) {
+      return lhs.moment > rhs.moment;
+    }
+
+    return lhs.id > rhs.id;
+  }
+
+  inline
+  std::uint64_t
+  WakeUpQueue::arm(WorldElement& element) noexcept {
+    element.m_alarm = ++m_lastAlarm;
+    return element.m_alarm;
+  }
+
+}
+
+#endif    /* WAKE_UP_QUEUE_HXX */
@@ -1,15 +1,21 @@
 
 # include "World.hh"
+# include <bit>
+# include <cstdint>
 # include <algorithm>
 # include <unordered_set>
 # include <fstream>
 # include "blocks/Spawner.hh"
+# include "blocks/SpawnerOMeter.hh"
 # include "blocks/BlockFactory.hh"
 # include "entities/EntityFactory.hh"
 # include "entities/Player.hh"
 # include "entities/Mob.hh"
+# include "effects/EvaporatingVFX.hh"
 # include "colonies/ColonyFactory.hh"
 # include <core_utils/TimeUtils.hh>
+# include "Trace.hh"
+# include "Logging.hh"
 
 namespace {
 
@@ -35,8 +41,8 @@ namespace {
     }
 
     // Decode the owner into a valid identifier.
-    utils::Uuid id = utils::Uuid::create(owner);
-    if (!id.valid()) {
+    new_frontiers::OwnerId id = new_frontiers::owner::intern(utils::Uuid::create(owner));
+    if (!new_frontiers::owner::valid(id)) {
       return nullptr;
     }
 
@@ -55,7 +61,7 @@ namespace {
 
       pp.owner = id;
 
-      return std::make_shared<new_frontiers::Warrior>(pp);
+      return new_frontiers::EntityFactory::newWarrior(pp);
     }
     if (kind == "worker") {
       new_frontiers::Worker::WProps pp = new_frontiers::EntityFactory::newWorkerProps(x, y, e);
@@ -68,17 +74,209 @@ namespace {
 
       pp.owner = id;
 
-      return std::make_shared<new_frontiers::Worker>(pp);
+      return new_frontiers::EntityFactory::newWorker(pp);
     }
 
     // Could not interpret the brain.
     return nullptr;
   }
 
+  /**
+   * @brief - Create the profiler measuring the phases of a step
+   *          of the world, in the order of `World::Phase`.
+   * @return - the created profiler.
+   */
+  inline
+  new_frontiers::ProfilerShPtr
+  createProfiler() {
+    return std::make_shared<new_frontiers::Profiler>(
+      "world",
+      std::vector<std::string>{
+        "step",
+        "blocks",
+        "entities",
+        "commit",
+        "vfx",
+        "colonies",
+        "influences",
+        "locator",
+        "reorder"
+      }
+    );
+  }
+
+  /**
+   * @brief - Discard the elements marked for removal from the
+   *          input list in a single pass, preserving the order
+   *          of the remaining ones.
+   * @param elements - the list of elements to compact.
+   * @param onRemove - called for each element discarded.
+   * @return - the number of elements discarded.
+   */
+  template <typename Element, typename Callback>
+  std::size_t
+  compact(std::vector<std::shared_ptr<Element>>& elements, Callback onRemove) {
+    std::size_t kept = 0u;
+
+    for (std::size_t id = 0u ; id < elements.size() ; ++id) {
+      if (elements[id] != nullptr && elements[id]->isRemoved()) {
+        onRemove(*elements[id]);
+        continue;
+      }
+
+      if (kept != id) {
+        elements[kept] = std::move(elements[id]);
+      }
+      ++kept;
+    }
+
+    std::size_t removed = elements.size() - kept;
+    elements.resize(kept);
+
+    return removed;
+  }
+
+  /**
+   * @brief - Compute the Morton code of the cell containing the
+   *          input position: the bits of the coordinates of the
+   *          cell are interleaved so that cells close to each
+   *          other in the world usually get close codes.
+   * @param p - the position.
+   * @return - the code of the cell.
+   */
+  inline
+  std::uint32_t
+  morton(const utils::Point2f& p) noexcept {
+    auto spread = [](std::uint32_t v) {
+      v &= 0xFFFFu;
+      v = (v | (v << 8u)) & 0x00FF00FFu;
+      v = (v | (v << 4u)) & 0x0F0F0F0Fu;
+      v = (v | (v << 2u)) & 0x33333333u;
+      v = (v | (v << 1u)) & 0x55555555u;
+
+      return v;
+    };
+
+    std::uint32_t x = static_cast<std::uint32_t>(std::max(p.x(), 0.0f));
+    std::uint32_t y = static_cast<std::uint32_t>(std::max(p.y(), 0.0f));
+
+    return spread(x) | (spread(y) << 1u);
+  }
+
+  /**
+   * @brief - Sort the input list of elements by Morton code of
+   *          their cell in case more than a fraction of them are
+   *          out of order. Elements in the same cell keep their
+   *          relative order.
+   * @param elements - the list of elements to reorder.
+   * @param drift - the fraction of consecutive elements out of
+   *                order above which the list is sorted.
+   * @param arena - the memory resource of the temporaries.
+   * @return - `true` if the list was sorted.
+   */
+  template <typename Element>
+  bool
+  reorder(std::vector<std::shared_ptr<Element>>& elements,
+          float drift,
+          std::pmr::memory_resource* arena)
+  {
+    // Each key holds the code of an element in its high
+    // bits and its current index in the low ones: keys
+    // are unique so the sort is deterministic.
+    std::pmr::vector<std::uint64_t> keys(arena);
+    keys.reserve(elements.size());
+
+    unsigned unordered = 0u;
+    for (unsigned id = 0u ; id < elements.size() ; ++id) {
+      std::uint64_t code = morton(elements[id]->getTile().p);
+      keys.push_back((code << 32u) | id);
+
+      if (id > 0u && keys[id] < keys[id - 1u]) {
+        ++unordered;
+      }
+    }
+
+    if (unordered <= drift * elements.size()) {
+      return false;
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    // Only keep the index of the element to move to each
+    // position, the highest bit marks positions already
+    // filled.
+    const std::uint64_t done = std::uint64_t(1u) << 63u;
+    for (unsigned id = 0u ; id < keys.size() ; ++id) {
+      keys[id] &= 0xFFFFFFFFu;
+    }
+
+    // Move elements along each cycle of the permutation.
+    for (unsigned id = 0u ; id < keys.size() ; ++id) {
+      if ((keys[id] & done) != 0u) {
+        continue;
+      }
+
+      std::shared_ptr<Element> first = std::move(elements[id]);
+      unsigned cur = id;
+
+      while (true) {
+        unsigned next = static_cast<unsigned>(keys[cur]);
+        keys[cur] |= done;
+
+        if (next == id) {
+          elements[cur] = std::move(first);
+          break;
+        }
+
+        elements[cur] = std::move(elements[next]);
+        cur = next;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief - Fold the location of the input elements and their
+   *          health if needed into a FNV-1a hash. The elements
+   *          are considered in order.
+   * @param elements - the elements to fold into the hash.
+   * @param health - `true` to also fold the health.
+   * @param hash - the hash to update.
+   */
+  template <typename Element>
+  void
+  fingerprint(const std::vector<std::shared_ptr<Element>>& elements,
+              bool health,
+              std::uint64_t& hash) noexcept
+  {
+    auto mix = [&hash](std::uint32_t bits) {
+      for (unsigned id = 0u ; id < 4u ; ++id) {
+        hash ^= (bits >> (8u * id)) & 0xFFu;
+        hash *= 0x100000001B3u;
+      }
+    };
+
+    mix(static_cast<std::uint32_t>(elements.size()));
+
+    for (unsigned id = 0u ; id < elements.size() ; ++id) {
+      mix(std::bit_cast<std::uint32_t>(elements[id]->getTile().p.x()));
+      mix(std::bit_cast<std::uint32_t>(elements[id]->getTile().p.y()));
+
+      if (health) {
+        mix(std::bit_cast<std::uint32_t>(elements[id]->getHealth()));
+      }
+    }
+  }
+
 }
 
 namespace new_frontiers {
 
+  const unsigned World::sk_elementsPerChunk = 256u;
+
+  const float World::sk_reorderDrift = 0.1f;
+
   World::World(int seed, int width, int height):
     utils::CoreObject("world"),
 
@@ -86,16 +284,41 @@ namespace new_frontiers {
     m_h(height),
 
     m_rng(seed),
+    m_time(),
+    m_lastId(0u),
 
     m_colonies(),
     m_blocks(),
     m_entities(),
     m_vfx(),
 
+    m_blocksQueue(),
+    m_vfxQueue(),
+    m_useComponents(false),
+    m_reorderInterval(0u),
+    m_sinceReorder(0u),
+    m_components(),
+    m_blockHandles(),
+    m_entityHandles(),
+    m_vfxHandles(),
+    m_coloniesQueue(),
+    m_dueBlocks(),
+    m_dueVFX(),
+    m_dueColonies(),
+    m_exchanges(),
+
     m_loc(nullptr),
 
     m_actions(),
-    m_influences()
+    m_viewport{0.0f, -1.0f, 0.0f, -1.0f},
+    m_influences(),
+
+    m_pool(std::make_shared<ThreadPool>(1u)),
+    m_graph(),
+    m_profiler(createProfiler()),
+    m_chunks(),
+    m_arenas(),
+    m_arena()
   {
     setService("world");
 
@@ -119,16 +342,41 @@ namespace new_frontiers {
     m_h(0),
 
     m_rng(seed),
+    m_time(),
+    m_lastId(0u),
 
     m_colonies(),
     m_blocks(),
     m_entities(),
     m_vfx(),
 
+    m_blocksQueue(),
+    m_vfxQueue(),
+    m_useComponents(false),
+    m_reorderInterval(0u),
+    m_sinceReorder(0u),
+    m_components(),
+    m_blockHandles(),
+    m_entityHandles(),
+    m_vfxHandles(),
+    m_coloniesQueue(),
+    m_dueBlocks(),
+    m_dueVFX(),
+    m_dueColonies(),
+    m_exchanges(),
+
     m_loc(nullptr),
 
     m_actions(),
-    m_influences()
+    m_viewport{0.0f, -1.0f, 0.0f, -1.0f},
+    m_influences(),
+
+    m_pool(std::make_shared<ThreadPool>(1u)),
+    m_graph(),
+    m_profiler(createProfiler()),
+    m_chunks(),
+    m_arenas(),
+    m_arena()
   {
     // Check dimensions.
     setService("world");
@@ -141,6 +389,20 @@ namespace new_frontiers {
   World::step(float tDelta,
               const controls::State& controls)
   {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    TRACE_ZONE("world::step");
+
+    // Move to the next tick for the random streams and
+    // advance the simulation time.
+    m_rng.advance();
+    utils::Duration dt = std::chrono::duration_cast<utils::Duration>(std::chrono::duration<float>(tDelta));
+    m_time += dt;
+
+    // Effects attached to the components are stepped at
+    // each step: they use the same elapsed time as what
+    // the queues would provide.
+    float elapsed = std::chrono::duration<float>(dt).count();
+
     // Create the step information structure.
     StepInfo si{
       0.0f,
@@ -148,80 +410,214 @@ namespace new_frontiers {
       0.0f,
       1.0f * m_h - 1.0f,
 
+      m_viewport.xMin,
+      m_viewport.xMax,
+      m_viewport.yMin,
+      m_viewport.yMax,
+
       m_rng,
 
       m_influences,
 
-      utils::now(),
+      m_time,
       tDelta,
 
       m_loc,
 
-      controls
+      controls,
+
+      &m_arena
     };
 
-    // Make elements evolve.
-    for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
-      m_blocks[id]->step(si);
+    // Gather the elements which are due at this step:
+    // queues are only modified once all elements have
+    // been stepped.
+    m_blocksQueue.due(m_time, m_dueBlocks);
+    m_vfxQueue.due(m_time, m_dueVFX);
+    m_coloniesQueue.due(m_time, m_dueColonies);
+
+    // Each chunk of elements gets its own list of
+    // influences: they are merged in the order of
+    // the chunks so that the result is the same no
+    // matter the number of threads used.
+    unsigned eStart = chunks(m_dueBlocks.size());
+    unsigned vStart = eStart + chunks(m_entities.size());
+    unsigned sStart = vStart + chunks(m_dueVFX.size());
+    unsigned cStart = sStart + chunks(m_components.size());
+    unsigned count = cStart + chunks(m_dueColonies.size());
+
+    if (m_chunks.size() < count) {
+      m_chunks.resize(count);
     }
-
-    for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
-      m_entities[id]->step(si);
+    while (m_arenas.size() < count) {
+      m_arenas.push_back(std::make_unique<Arena>());
     }
 
-    for (unsigned id = 0u ; id < m_vfx.size() ; ++id) {
-      m_vfx[id]->step(si);
-    }
+    // Jobs only capture the world and this frame so that
+    // they fit in the storage of a `std::function`, which
+    // spares an allocation for each of them at each step.
+    struct Frame {
+      const StepInfo& si;
+      unsigned eStart, vStart, sStart, cStart;
+      float elapsed;
+    };
 
-    // Finally make colonies evolve.
-    for (unsigned id = 0u ; id < m_colonies.size() ; ++id) {
-      m_colonies[id]->step(si);
-    }
+    Frame f{si, eStart, vStart, sStart, cStart, elapsed};
+
+    // Make elements evolve: the phases are executed as
+    // if they were run in sequence but the ones which
+    // do not access the same data run concurrently. In
+    // particular effects and colonies do not need to
+    // wait for each other.
+    m_graph.clear();
+
+    m_graph.add(
+      "blocks",
+      eStart,
+      task::Blocks | task::Entities,
+      task::Blocks,
+      [this, &f](unsigned chunk) {
+        ScopedTimer t(*m_profiler, Blocks);
+        stepDue(m_dueBlocks, chunk, f.si, m_chunks[chunk], *m_arenas[chunk]);
+      }
+    );
+
+    // Entities attached to the components get their
+    // energy replenished in a single loop before they
+    // are stepped.
+    m_graph.add(
+      "energy",
+      m_useComponents ? vStart - eStart : 0u,
+      task::None,
+      task::Entities,
+      [this, &f](unsigned chunk) {
+        ScopedTimer t(*m_profiler, Entities);
+        unsigned end = std::min<unsigned>((chunk + 1u) * sk_elementsPerChunk, m_components.entities());
+        m_components.refill(chunk * sk_elementsPerChunk, end, f.si.elapsed);
+      }
+    );
+
+    // Entities only modify their own state: any change
+    // to other elements goes through an influence.
+    m_graph.add(
+      "entities",
+      vStart - eStart,
+      task::Blocks | task::Entities | task::Effects,
+      task::Entities,
+      [this, &f](unsigned chunk) {
+        ScopedTimer t(*m_profiler, Entities);
+        stepEntities(chunk, f.si, m_chunks[f.eStart + chunk], *m_arenas[f.eStart + chunk]);
+      }
+    );
+
+    // Publish the new positions of entities now that no
+    // other entity is reading them. Entities attached to
+    // the components are also moved along their path at
+    // this point.
+    m_graph.add(
+      "commit",
+      vStart - eStart,
+      task::None,
+      task::Entities,
+      [this, &f](unsigned chunk) {
+        ScopedTimer t(*m_profiler, Commit);
+        unsigned end = std::min<unsigned>((chunk + 1u) * sk_elementsPerChunk, m_entities.size());
+
+        if (m_useComponents) {
+          m_components.move(chunk * sk_elementsPerChunk, end, f.si.elapsed);
+          return;
+        }
+
+        for (unsigned id = chunk * sk_elementsPerChunk ; id < end ; ++id) {
+          m_entities[id]->commit();
+        }
+      }
+    );
+
+    m_graph.add(
+      "vfx",
+      cStart - vStart,
+      task::None,
+      task::Effects,
+      [this, &f](unsigned chunk) {
+        ScopedTimer t(*m_profiler, Effects);
+        if (f.vStart + chunk < f.sStart) {
+          stepDue(m_dueVFX, chunk, f.si, m_chunks[f.vStart + chunk], *m_arenas[f.vStart + chunk]);
+        }
+        else {
+          stepComponents(f.vStart + chunk - f.sStart, f.elapsed, m_chunks[f.vStart + chunk]);
+        }
+      }
+    );
+
+    // Colonies count the enemies close to their home so
+    // they read the positions published by the commit:
+    // they run after it, possibly alongside effects.
+    m_graph.add(
+      "colonies",
+      count - cStart,
+      task::Blocks | task::Entities,
+      task::Colonies,
+      [this, &f](unsigned chunk) {
+        ScopedTimer t(*m_profiler, Colonies);
+        stepDue(m_dueColonies, chunk, f.si, m_chunks[f.cStart + chunk], *m_arenas[f.cStart + chunk]);
+      }
+    );
 
-    // Process influences.
-    processInfluences();
-  }
+    m_graph.run(*m_pool);
 
-  void
-  World::pause(float /*tDelta*/,
-               const controls::State& /*controls*/)
-  {
-    // Call the pause method on each world element. The
-    // pause method is invoked at this moment in time.
-    utils::TimeStamp moment = utils::now();
+    // Schedule the next step of elements and merge the
+    // influences they produced.
+    reschedule(m_blocksQueue, m_dueBlocks, m_time);
+    reschedule(m_vfxQueue, m_dueVFX, m_time);
+    reschedule(m_coloniesQueue, m_dueColonies, m_time);
 
-    for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
-      m_blocks[id]->pause(moment);
+    std::size_t total = m_influences.size();
+    for (unsigned id = 0u ; id < count ; ++id) {
+      total += m_chunks[id].size();
     }
+    m_influences.reserve(total);
 
-    for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
-      m_entities[id]->pause(moment);
+    for (unsigned id = 0u ; id < count ; ++id) {
+      m_influences.insert(
+        m_influences.end(),
+        std::make_move_iterator(m_chunks[id].begin()),
+        std::make_move_iterator(m_chunks[id].end())
+      );
+      m_chunks[id].clear();
+      m_arenas[id]->reset();
     }
 
-    for (unsigned id = 0u ; id < m_vfx.size() ; ++id) {
-      m_vfx[id]->pause(moment);
-    }
-  }
+    // Process influences.
+    processInfluences();
 
-  void
-  World::resume(float /*tDelta*/,
-                const controls::State& /*controls*/)
-  {
-    // Call the resume method on each world element. The
-    // pause method is invoked at this moment in time.
-    utils::TimeStamp moment = utils::now();
+    // Sort the entities and effects by location in case
+    // they moved too much since the last time.
+    if (m_reorderInterval > 0u && ++m_sinceReorder >= m_reorderInterval) {
+      ScopedTimer rt(*m_profiler, Reorder);
+      m_sinceReorder = 0u;
+
+      bool sorted = reorder(m_entities, sk_reorderDrift, &m_arena);
+      sorted = reorder(m_vfx, sk_reorderDrift, &m_arena) || sorted;
+
+      // The slots of entities in the components follow
+      // their order in the world: attach them again.
+      if (sorted && m_useComponents) {
+        m_components.detachEntities();
+        for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
+          m_components.attach(*m_entities[id]);
+        }
+      }
 
-    for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
-      m_blocks[id]->resume(moment);
+      if (sorted) {
+        NF_VERBOSE("Reordered " + std::to_string(m_entities.size()) + " entity(ies) and " + std::to_string(m_vfx.size()) + " effect(s) by location");
+      }
     }
 
-    for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
-      m_entities[id]->resume(moment);
-    }
+    m_arena.reset();
 
-    for (unsigned id = 0u ; id < m_vfx.size() ; ++id) {
-      m_vfx[id]->resume(moment);
-    }
+    m_profiler->record(Step, std::chrono::steady_clock::now() - start);
+    m_profiler->tick();
   }
 
   void
@@ -243,11 +639,9 @@ namespace new_frontiers {
 
         m_actions.block->owner = m_actions.owner;
 
-        m_influences.push_back(
-          std::make_shared<Influence>(
-            influence::Type::BlockSpawn,
-            BlockFactory::newBlockFromProps(*m_actions.block)
-          )
+        m_influences.emplace_back(
+          influence::Type::BlockSpawn,
+          BlockFactory::newBlockFromProps(*m_actions.block)
         );
         break;
       case ActionType::VFX:
@@ -256,11 +650,9 @@ namespace new_frontiers {
 
         m_actions.vfx->owner = m_actions.owner;
 
-        m_influences.push_back(
-          std::make_shared<Influence>(
-            influence::Type::VFXSpawn,
-            PheromonFactory::newPheromon(*std::dynamic_pointer_cast<Pheromon::PProps>(m_actions.vfx))
-          )
+        m_influences.emplace_back(
+          influence::Type::VFXSpawn,
+          PheromonFactory::newPheromon(*std::dynamic_pointer_cast<Pheromon::PProps>(m_actions.vfx))
         );
         break;
       case ActionType::Entity:
@@ -269,21 +661,26 @@ namespace new_frontiers {
 
         m_actions.ent->owner = m_actions.owner;
 
-        m_influences.push_back(
-          std::make_shared<Influence>(
-            influence::Type::EntitySpawn,
-            EntityFactory::newEntityFromProps(*m_actions.ent)
-          )
+        m_influences.emplace_back(
+          influence::Type::EntitySpawn,
+          EntityFactory::newEntityFromProps(*m_actions.ent)
         );
         break;
       case ActionType::None:
         // Nothing to do if no action type is selected.
-        debug("Not implemented or nothing to do");
+        NF_DEBUG("Not implemented or nothing to do");
       default:
         break;
     }
   }
 
+  void
+  World::apply(const std::vector<Influence>& influences) {
+    m_influences.insert(m_influences.end(), influences.cbegin(), influences.cend());
+
+    processInfluences();
+  }
+
   void
   World::generateElements() {
     // Generate the colonies.
@@ -330,72 +727,318 @@ namespace new_frontiers {
     // Generate the player at the same location
     // as the entry portal.
     Player::PProps plp = EntityFactory::newPlayerProps(1.0f, 1.0f, tiles::Gorgone);
-    m_entities.push_back(std::make_shared<Player>(plp));
+    m_entities.push_back(EntityFactory::newPlayer(plp));
+  }
+
+  std::uint64_t
+  World::digest() const noexcept {
+    std::uint64_t hash = 0xCBF29CE484222325u;
+
+    fingerprint(m_blocks, true, hash);
+    fingerprint(m_entities, true, hash);
+
+    // The state of evaporating effects may be held by the
+    // components: only consider their location.
+    fingerprint(m_vfx, false, hash);
+
+    return hash;
+  }
+
+  std::size_t
+  World::buffersCapacity() const noexcept {
+    std::size_t total = m_arena.capacity() + m_arenas.size() * sizeof(Arena);
+    for (unsigned id = 0u ; id < m_arenas.size() ; ++id) {
+      total += m_arenas[id]->capacity();
+    }
+
+    std::size_t influences = m_influences.capacity();
+    for (unsigned id = 0u ; id < m_chunks.size() ; ++id) {
+      influences += m_chunks[id].capacity();
+    }
+
+    std::size_t alarms = m_dueBlocks.capacity() + m_dueVFX.capacity() + m_dueColonies.capacity();
+
+    return total +
+      influences * sizeof(Influence) +
+      m_exchanges.capacity() * sizeof(Exchange) +
+      alarms * sizeof(WakeUpQueue::Alarm);
+  }
+
+  void
+  World::stepDue(std::vector<WakeUpQueue::Alarm>& alarms,
+                 unsigned chunk,
+                 const StepInfo& info,
+                 std::vector<Influence>& influences,
+                 Arena& arena)
+  {
+    // Each element draws from its own stream so using
+    // a copy of the generator does not change the values
+    // it gets.
+    CounterRNG rng(info.rng);
+    StepInfo ci = info.fork(rng, influences, &arena);
+
+    unsigned end = std::min<unsigned>((chunk + 1u) * sk_elementsPerChunk, alarms.size());
+    TRACE_ZONE_ARG(zone, "world::stepDue", "chunk", chunk);
+
+    for (unsigned id = chunk * sk_elementsPerChunk ; id < end ; ++id) {
+      WorldElement& e = *alarms[id].element;
+
+      ci.rng.reset(e.getId());
+      ci.elapsed = alarms[id].elapsed;
+      e.step(ci);
+    }
+  }
+
+  void
+  World::stepEntities(unsigned chunk,
+                      const StepInfo& info,
+                      std::vector<Influence>& influences,
+                      Arena& arena)
+  {
+    CounterRNG rng(info.rng);
+    StepInfo ci = info.fork(rng, influences, &arena);
+
+    unsigned end = std::min<unsigned>((chunk + 1u) * sk_elementsPerChunk, m_entities.size());
+    TRACE_ZONE_ARG(zone, "world::stepEntities", "chunk", chunk);
+
+    for (unsigned id = chunk * sk_elementsPerChunk ; id < end ; ++id) {
+      ci.rng.reset(m_entities[id]->getId());
+      m_entities[id]->step(ci);
+    }
+  }
+
+  void
+  World::stepComponents(unsigned chunk,
+                        float elapsed,
+                        std::vector<Influence>& influences)
+  {
+    unsigned end = std::min<unsigned>((chunk + 1u) * sk_elementsPerChunk, m_components.size());
+    TRACE_ZONE_ARG(zone, "world::stepComponents", "chunk", chunk);
+
+    m_components.evaporate(chunk * sk_elementsPerChunk, end, elapsed, influences);
+  }
+
+  void
+  World::reschedule(WakeUpQueue& queue,
+                    std::vector<WakeUpQueue::Alarm>& alarms,
+                    const utils::TimeStamp& moment)
+  {
+    for (unsigned id = 0u ; id < alarms.size() ; ++id) {
+      WorldElementShPtr e = alarms[id].element;
+      queue.schedule(e, e->nextWakeUp(moment));
+    }
+
+    alarms.clear();
+  }
+
+  void
+  World::setComponentStorage(bool enable) {
+    if (enable == m_useComponents) {
+      return;
+    }
+
+    m_useComponents = enable;
+
+    // Move the existing evaporating effects to their
+    // new schedule: they are stepped at each step so
+    // they resume from the current time.
+    for (unsigned id = 0u ; id < m_vfx.size() ; ++id) {
+      if (m_useComponents) {
+        EvaporatingVFX* ev = dynamic_cast<EvaporatingVFX*>(m_vfx[id].get());
+        if (ev != nullptr) {
+          m_vfxQueue.remove(*ev);
+          m_components.attach(*ev);
+        }
+      }
+      else if (m_vfx[id]->isAttached()) {
+        m_components.detach(*m_vfx[id]);
+        m_vfxQueue.insert(m_vfx[id], m_time);
+      }
+    }
+
+    // Entities are all attached, in the same order as
+    // in the world.
+    if (m_useComponents) {
+      for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
+        m_components.attach(*m_entities[id]);
+      }
+    }
+    else {
+      m_components.detachEntities();
+    }
+
+    info(
+      std::string(m_useComponents ? "Enabled" : "Disabled") + " component storage, " +
+      std::to_string(m_components.size()) + " effect(s) and " +
+      std::to_string(m_components.entities()) + " entity(ies) attached"
+    );
+  }
+
+  void
+  World::setReorderInterval(unsigned steps) {
+    m_reorderInterval = steps;
+    m_sinceReorder = 0u;
+  }
+
+  void
+  World::schedule(VFXShPtr vfx) {
+    EvaporatingVFX* ev = nullptr;
+    if (m_useComponents) {
+      ev = dynamic_cast<EvaporatingVFX*>(vfx.get());
+    }
+
+    if (ev == nullptr) {
+      m_vfxQueue.insert(vfx, m_time);
+      return;
+    }
+
+    m_components.attach(*ev);
   }
 
   void
   World::processInfluences() {
-    // Process each influence.
-    std::size_t bCount = m_blocks.size();
+    ScopedTimer t(*m_profiler, Influences);
+    TRACE_ZONE_ARG(zone, "world::processInfluences", "influences", m_influences.size());
+
+    // Process each influence. Removals only mark the
+    // elements: they are discarded all at once at the
+    // end so that the cost is linear in the number of
+    // elements no matter how many are removed.
+    // Influences referring to elements through a stale
+    // handle are ignored.
+    bool blocksChanged = false, exchanges = false;
+    bool bRemoval = false, eRemoval = false, vRemoval = false;
+    unsigned stale = 0u;
 
     for (unsigned id = 0; id < m_influences.size() ; ++id) {
-      InfluenceShPtr i = m_influences[id];
+      const Influence& i = m_influences[id];
 
-      switch (i->getType()) {
+      switch (i.getType()) {
         case influence::Type::BlockSpawn:
-          m_blocks.push_back(i->getShPBlock());
+          // A removal processed before the spawn of the
+          // element does not apply to it.
+          i.getShPBlock()->setRemoved(false);
+          identify(*i.getShPBlock());
+          m_blocks.push_back(i.getShPBlock());
+          m_blockHandles.acquire(i.getShPBlock());
+          m_blocksQueue.insert(i.getShPBlock(), m_time);
+          blocksChanged = true;
           break;
         case influence::Type::BlockRemoval: {
-          auto toRm = std::find_if(
-            m_blocks.cbegin(),
-            m_blocks.cend(),
-            [&i](const BlockShPtr& blo) {
-              return blo != nullptr && blo.get() == i->getBlock();
-            }
-          );
-          if (toRm != m_blocks.end()) {
-            m_blocks.erase(toRm);
+          Block* b = m_blockHandles.resolve(i.getBlock());
+          if (b == nullptr) {
+            ++stale;
+            break;
           }
+
+          b->setRemoved(true);
+          bRemoval = true;
+          } break;
+        case influence::Type::BlockWakeUp: {
+          BlockShPtr b = m_blockHandles.share(i.getBlock());
+          if (b == nullptr) {
+            ++stale;
+            break;
+          }
+
+          m_blocksQueue.wake(b);
           } break;
         case influence::Type::EntitySpawn:
-          m_entities.push_back(i->getShPEntity());
+          i.getShPEntity()->setRemoved(false);
+          identify(*i.getShPEntity());
+          m_entities.push_back(i.getShPEntity());
+          m_entityHandles.acquire(i.getShPEntity());
+          if (m_useComponents) {
+            m_components.attach(*i.getShPEntity());
+          }
           break;
         case influence::Type::EntityRemoval: {
-          auto toRm = std::find_if(
-            m_entities.cbegin(),
-            m_entities.cend(),
-            [&i](const EntityShPtr& ent) {
-              return ent != nullptr && ent.get() == i->getEntity();
-            }
-          );
-          if (toRm != m_entities.end()) {
-            m_entities.erase(toRm);
+          Entity* e = m_entityHandles.resolve(i.getEntity());
+          if (e == nullptr) {
+            ++stale;
+            break;
           }
+
+          e->setRemoved(true);
+          eRemoval = true;
           } break;
         case influence::Type::VFXSpawn:
-          m_vfx.push_back(i->getShPVFX());
+          i.getShPVFX()->setRemoved(false);
+          identify(*i.getShPVFX());
+          m_vfx.push_back(i.getShPVFX());
+          m_vfxHandles.acquire(i.getShPVFX());
+          schedule(i.getShPVFX());
           break;
         case influence::Type::VFXRemoval: {
-          auto toRm = std::find_if(
-            m_vfx.cbegin(),
-            m_vfx.cend(),
-            [&i](const VFXShPtr& vfx) {
-              return vfx != nullptr && vfx.get() == i->getVFX();
-            }
-          );
-          if (toRm != m_vfx.end()) {
-            m_vfx.erase(toRm);
+          VFX* v = m_vfxHandles.resolve(i.getVFX());
+          if (v == nullptr) {
+            ++stale;
+            break;
           }
+
+          v->setRemoved(true);
+          vRemoval = true;
           } break;
+        case influence::Type::Damage:
+        case influence::Type::Harvest:
+        case influence::Type::Refill:
+          // Resolved once all influences are known.
+          exchanges = true;
+          break;
         default:
-          warn("Unhandled influence with type " + std::to_string(static_cast<int>(i->getType())));
+          warn("Unhandled influence with type " + std::to_string(static_cast<int>(i.getType())));
           break;
       }
     }
 
-    // In case the number of blocks has been changed
-    // we need to update the locator.
-    if (m_blocks.size() != bCount) {
+    if (exchanges && resolveExchanges(stale)) {
+      eRemoval = true;
+    }
+
+    if (stale > 0u) {
+      NF_VERBOSE("Ignored " + std::to_string(stale) + " influence(s) referring to removed elements");
+    }
+
+    // Discard the elements marked for removal.
+    if (bRemoval) {
+      std::size_t count = compact(
+        m_blocks,
+        [this](Block& b) {
+          m_blocksQueue.remove(b);
+          m_blockHandles.release(b.getHandle());
+        }
+      );
+
+      blocksChanged = blocksChanged || count > 0u;
+    }
+
+    if (eRemoval) {
+      // The components still refer to the entities so
+      // they are compacted first.
+      m_components.compactEntities();
+      compact(
+        m_entities,
+        [this](Entity& e) {
+          m_entityHandles.release(e.getHandle());
+        }
+      );
+    }
+
+    if (vRemoval) {
+      compact(
+        m_vfx,
+        [this](VFX& v) {
+          m_vfxQueue.remove(v);
+          m_components.detach(v);
+          m_vfxHandles.release(v.getHandle());
+        }
+      );
+    }
+
+    // In case the blocks have been changed we need
+    // to update the locator.
+    if (blocksChanged) {
+      ScopedTimer rt(*m_profiler, Refresh);
       m_loc->refresh();
     }
 
@@ -404,6 +1047,135 @@ namespace new_frontiers {
     m_influences.clear();
   }
 
+  bool
+  World::resolveExchanges(unsigned& stale) {
+    // Gather the influences applying to each element:
+    // the index of the exchange of each element is only
+    // needed during this step. There is at most one
+    // exchange per influence so the list only grows
+    // along with the list of influences.
+    m_exchanges.clear();
+    m_exchanges.reserve(m_influences.capacity());
+    std::pmr::unordered_map<const WorldElement*, unsigned> ids(&m_arena);
+
+    for (unsigned id = 0u ; id < m_influences.size() ; ++id) {
+      const Influence& i = m_influences[id];
+      const influence::Type& t = i.getType();
+
+      if (t != influence::Type::Damage && t != influence::Type::Harvest && t != influence::Type::Refill) {
+        continue;
+      }
+
+      WorldElement* r = receiver(i);
+      if (r == nullptr) {
+        ++stale;
+        continue;
+      }
+
+      auto it = ids.emplace(r, m_exchanges.size());
+      if (it.second) {
+        m_exchanges.push_back(Exchange{id, r, 0.0f, 0.0f, 1.0f});
+      }
+
+      Exchange& e = m_exchanges[it.first->second];
+
+      if (t == influence::Type::Refill && i.getAmount() >= 0.0f) {
+        e.supply += i.getAmount();
+      }
+      else {
+        e.demand += std::abs(i.getAmount());
+      }
+    }
+
+    // Apply the exchanges to each element and compute
+    // how much of the requests can be granted.
+    bool killed = false;
+
+    for (unsigned id = 0u ; id < m_exchanges.size() ; ++id) {
+      Exchange& e = m_exchanges[id];
+      const Influence& i = m_influences[e.first];
+
+      float stock = 0.0f;
+
+      switch (i.getType()) {
+        case influence::Type::Damage: {
+          Entity* ent = static_cast<Entity*>(e.receiver);
+          if (!ent->damage(e.demand) && !ent->isRemoved()) {
+            ent->setRemoved(true);
+            killed = true;
+          }
+          } break;
+        case influence::Type::Harvest: {
+          Deposit* d = static_cast<Deposit*>(e.receiver);
+          stock = d->getStock();
+
+          if (e.demand > stock) {
+            e.scale = (e.demand > 0.0f ? std::max(stock, 0.0f) / e.demand : 0.0f);
+          }
+          d->refill(-e.demand * e.scale, false);
+          } break;
+        case influence::Type::Refill: {
+          SpawnerOMeter* s = static_cast<SpawnerOMeter*>(e.receiver);
+          s->refill(e.supply);
+          stock = s->getStock();
+
+          if (e.demand > stock) {
+            e.scale = (e.demand > 0.0f ? std::max(stock, 0.0f) / e.demand : 0.0f);
+          }
+          if (e.demand > 0.0f) {
+            s->refill(-e.demand * e.scale, false);
+          }
+          } break;
+        default:
+          break;
+      }
+    }
+
+    // Hand over the resources to the mobs which requested
+    // them: harvesters drop what they were refused while
+    // mobs drawing from a spawner are healed.
+    for (unsigned id = 0u ; id < m_influences.size() ; ++id) {
+      const Influence& i = m_influences[id];
+      if (!i.getMob().valid()) {
+        continue;
+      }
+
+      Mob* m = dynamic_cast<Mob*>(m_entityHandles.resolve(i.getMob()));
+      auto it = ids.find(receiver(i));
+
+      if (m == nullptr || it == ids.cend()) {
+        continue;
+      }
+
+      const Exchange& e = m_exchanges[it->second];
+
+      if (i.getType() == influence::Type::Harvest) {
+        m->unload(i.getAmount() * (1.0f - e.scale));
+      }
+      else if (i.getType() == influence::Type::Refill && i.getAmount() < 0.0f) {
+        m->damage(i.getAmount() * e.scale);
+      }
+    }
+
+    return killed;
+  }
+
+  WorldElement*
+  World::receiver(const Influence& i) const noexcept {
+    // Exchanges with blocks are only valid with the type
+    // of block they were requested for.
+    switch (i.getType()) {
+      case influence::Type::Damage:
+        return m_entityHandles.resolve(i.getEntity());
+      case influence::Type::Harvest:
+        return dynamic_cast<Deposit*>(m_blockHandles.resolve(i.getBlock()));
+      case influence::Type::Refill:
+        return dynamic_cast<SpawnerOMeter*>(m_blockHandles.resolve(i.getBlock()));
+      default:
+        return nullptr;
+    }
+  }
+
   void
   World::loadFromFile(const std::string& file) {
     // Open the file.
@@ -431,7 +1203,7 @@ namespace new_frontiers {
         break;
       }
 
-      debug("Reading section \"" + section + "\" from \"" + file + "\"");
+      NF_DEBUG("Reading section \"" + section + "\" from \"" + file + "\"");
 
       if (section == "colonies") {
         loadColonies(in);
@@ -464,7 +1236,21 @@ namespace new_frontiers {
       );
     }
 
-    m_loc = std::make_shared<Locator>(m_w, m_h, m_blocks, m_entities, m_vfx, m_colonies);
+    identifyAll();
+    scheduleAll();
+
+    m_loc = std::make_shared<Locator>(
+      m_w,
+      m_h,
+      m_blocks,
+      m_entities,
+      m_vfx,
+      m_colonies,
+      m_blockHandles,
+      m_entityHandles,
+      m_vfxHandles,
+      m_components
+    );
   }
 
   void
@@ -526,7 +1312,7 @@ namespace new_frontiers {
         continue;
       }
 
-      verbose("Registering colony at " + std::to_string(x) + "x" + std::to_string(y));
+      NF_VERBOSE("Registering colony at " + std::to_string(x) + "x" + std::to_string(y));
 
       // Note that we only allow creation of portals
       // with a spawner-o-meter type for now.
@@ -605,8 +1391,8 @@ namespace new_frontiers {
         continue;
       }
 
-      utils::Uuid id = utils::Uuid::create(owner);
-      if (!id.valid()) {
+      OwnerId id = owner::intern(utils::Uuid::create(owner));
+      if (!owner::valid(id)) {
         warn(
           "Could not decode owner of portal \"" + owner + "\" at " +
           std::to_string(x) + "x" + std::to_string(y)
@@ -615,7 +1401,7 @@ namespace new_frontiers {
         continue;
       }
 
-      verbose("Registering portal spawning " + mobStr + " at " + std::to_string(x) + "x" + std::to_string(y));
+      NF_VERBOSE("Registering portal spawning " + mobStr + " at " + std::to_string(x) + "x" + std::to_string(y));
 
       // Note that we only allow creation of portals
       // with a spawner-o-meter type for now.
@@ -677,7 +1463,7 @@ namespace new_frontiers {
       if (section == "wall") {
         in >> health >> type >> x >> y;
 
-        verbose("Registering wall " + std::to_string(type) + " at " + std::to_string(x) + "x" + std::to_string(y));
+        NF_VERBOSE("Registering wall " + std::to_string(type) + " at " + std::to_string(x) + "x" + std::to_string(y));
 
         Block::Props pp = BlockFactory::newWallProps(x, y, type);
         pp.health = health;
@@ -687,7 +1473,7 @@ namespace new_frontiers {
       else if (section == "deposit") {
         in >> x >> y >> health >> stock;
 
-        verbose("Registering deposit with stock " + std::to_string(stock) + " at " + std::to_string(x) + "x" + std::to_string(y));
+        NF_VERBOSE("Registering deposit with stock " + std::to_string(stock) + " at " + std::to_string(x) + "x" + std::to_string(y));
 
         Deposit::DProps pp = BlockFactory::newDepositProps(x, y);
         pp.health = health;
@@ -1,16 +1,25 @@
 #ifndef    WORLD_HH
 # define   WORLD_HH
 
+# include <cstdint>
 # include <memory>
 # include <fstream>
+# include <unordered_map>
 # include <core_utils/CoreObject.hh>
-# include <core_utils/RNG.hh>
+# include <core_utils/TimeUtils.hh>
 # include "Tiles.hh"
+# include "Arena.hh"
 # include "colonies/Colony.hh"
 # include "Element.hh"
 # include "Locator.hh"
+# include "Profiler.hh"
 # include "Controls.hh"
 # include "Influence.hh"
+# include "Components.hh"
+# include "TaskGraph.hh"
+# include "ThreadPool.hh"
+# include "CounterRNG.hh"
+# include "WakeUpQueue.hh"
 # include "blocks/Deposit.hh"
 # include "effects/Pheromon.hh"
 
@@ -57,12 +66,46 @@ namespace new_frontiers {
       LocatorShPtr
       locator() const noexcept;
 
+      /**
+       * @brief - Return the profiler measuring the time spent in
+       *          each phase of the steps of this world. A tick of
+       *          the profiler corresponds to a step.
+       * @return - the profiler of the world.
+       */
+      ProfilerShPtr
+      profiler() const noexcept;
+
+      /**
+       * @brief - Compute a hash of the state of the blocks, the
+       *          entities and the effects of the world. It allows
+       *          to check that two runs reached the same state, for
+       *          example with a different number of threads.
+       * @return - the hash of the state of the world.
+       */
+      std::uint64_t
+      digest() const noexcept;
+
+      /**
+       * @brief - Return the memory held by the buffers reused from
+       *          one step to the next: the arenas serving transient
+       *          containers and the lists of influences and of the
+       *          elements due at each step. They keep their memory
+       *          so this only increases when a step needs more than
+       *          any of the previous ones.
+       * @return - the capacity of the buffers in bytes.
+       */
+      std::size_t
+      buffersCapacity() const noexcept;
+
       /**
        * @brief - Used to move one step ahead in time in this
        *          world, given that `tDelta` represents the
        *          duration of the last frame in seconds. The
        *          method is also given the controls as input
        *          so that it can be made available to entities.
+       *          The simulation time only advances through this
+       *          method: pausing the world is achieved by not
+       *          calling it.
        * @param tDelta - the duration of the last frame in
        *                 seconds.
        * @param controls - the current state of the controls.
@@ -72,30 +115,57 @@ namespace new_frontiers {
            const controls::State& controls);
 
       /**
-       * @brief - Used to indicate that the world should be
-       *          paused. Time based entities and actions
-       *          should take actions to correctly resume at
-       *          a later time.
-       * @param tDelta - the duration of the last frame in
-       *                 seconds.
-       * @param controls - the current state of the controls.
+       * @brief - Define the number of threads to use to step the
+       *          elements of the world. The result of a step does
+       *          not depend on this value: only the throughput is
+       *          affected.
+       * @param threads - the number of threads to use, including
+       *                  the one calling `step`. A value of `0` is
+       *                  interpreted as `1`.
        */
       void
-      pause(float tDelta,
-            const controls::State& controls);
+      setStepThreads(unsigned threads);
 
       /**
-       * @brief - Used to indicate that the world should be
-       *          resuming its activity. Time based entities
-       *          should take actions to be resuming their
-       *          pathes, motions, etc.
-       * @param tDelta - the duration of the last frame in
-       *                 seconds.
-       * @param controls - the current state of the controls.
+       * @brief - Define whether the state of evaporating effects
+       *          and the position and energy of entities are held
+       *          in contiguous components updated in linear loops
+       *          rather than by stepping each element individually.
+       *          The result of a step does not depend on this value.
+       *          Disabled by default.
+       * @param enable - `true` to use the components.
        */
       void
-      resume(float tDelta,
-             const controls::State& controls);
+      setComponentStorage(bool enable);
+
+      /**
+       * @brief - Define how often the lists of entities and effects
+       *          are checked to be still ordered by location (using
+       *          the Morton code of the cell of each element). They
+       *          are sorted again when too many elements drifted so
+       *          that elements close to each other in the world are
+       *          processed one after the other. Elements are only
+       *          referred to through handles so this does not need
+       *          to update anything else. The result of a step does
+       *          not depend on the number of threads used whatever
+       *          this value. Disabled by default.
+       * @param steps - the number of steps between two checks, `0`
+       *                to disable the reordering.
+       */
+      void
+      setReorderInterval(unsigned steps);
+
+      /**
+       * @brief - Define the area of the world currently displayed
+       *          on screen: elements located in it are updated at
+       *          a higher rate. By default nothing is displayed.
+       * @param xMin - the minimum abscissa of the area in cells.
+       * @param yMin - the minimum ordinate of the area in cells.
+       * @param xMax - the maximum abscissa of the area in cells.
+       * @param yMax - the maximum ordinate of the area in cells.
+       */
+      void
+      setViewport(float xMin, float yMin, float xMax, float yMax);
 
       /**
        * @brief - Used to assign a new value for the properties
@@ -145,6 +215,19 @@ namespace new_frontiers {
       void
       performAction(float x, float y);
 
+      /**
+       * @brief - Register the input influences and process them
+       *          right away, as it is done at the end of a step.
+       *          This allows to populate the world or to remove
+       *          elements from it outside of a step, typically
+       *          to build synthetic scenarios.
+       *          Should only be called from the thread stepping
+       *          the world.
+       * @param influences - the influences to process.
+       */
+      void
+      apply(const std::vector<Influence>& influences);
+
     private:
 
       /**
@@ -169,6 +252,112 @@ namespace new_frontiers {
       void
       generateElements();
 
+      /**
+       * @brief - Assign a new identifier to the input element. It
+       *          should be called whenever an element is added to
+       *          the world.
+       * @param e - the element to identify.
+       */
+      void
+      identify(WorldElement& e) noexcept;
+
+      /**
+       * @brief - Assign an identifier to all the elements of the
+       *          world, typically after the world was generated
+       *          or loaded from a file. Blocks, entities and effects
+       *          are also given a handle.
+       */
+      void
+      identifyAll();
+
+      /**
+       * @brief - Register all the blocks, effects and colonies of
+       *          the world in their wake-up queue, typically after
+       *          the world was generated or loaded from a file.
+       */
+      void
+      scheduleAll();
+
+      /**
+       * @brief - Step a chunk of the elements due at this step.
+       *          Each element is provided the time elapsed since
+       *          it was last stepped.
+       *          Chunks are stepped concurrently: each one gets
+       *          its own random number generator, list of
+       *          influences and arena.
+       * @param alarms - the elements due at this step.
+       * @param chunk - the index of the chunk to step.
+       * @param info - the information about the current step.
+       * @param influences - the list of influences of the chunk.
+       * @param arena - the arena of the chunk.
+       */
+      void
+      stepDue(std::vector<WakeUpQueue::Alarm>& alarms,
+              unsigned chunk,
+              const StepInfo& info,
+              std::vector<Influence>& influences,
+              Arena& arena);
+
+      /**
+       * @brief - Used to make a chunk of the entities of the world
+       *          evolve. Similarly to `stepDue` chunks of entities
+       *          are stepped concurrently.
+       * @param chunk - the index of the chunk to step.
+       * @param info - the information about the current step.
+       * @param influences - the list of influences of the chunk.
+       * @param arena - the arena of the chunk.
+       */
+      void
+      stepEntities(unsigned chunk,
+                   const StepInfo& info,
+                   std::vector<Influence>& influences,
+                   Arena& arena);
+
+      /**
+       * @brief - Make a chunk of the effects attached to the
+       *          components evaporate. Similarly to `stepDue`
+       *          chunks are processed concurrently.
+       * @param chunk - the index of the chunk to process.
+       * @param elapsed - the time elapsed since the last step.
+       * @param influences - the list of influences of the chunk.
+       */
+      void
+      stepComponents(unsigned chunk,
+                     float elapsed,
+                     std::vector<Influence>& influences);
+
+      /**
+       * @brief - Register a new effect for its next steps: it is
+       *          either attached to the components if it supports
+       *          it and they are enabled or scheduled in the queue
+       *          of effects.
+       * @param vfx - the effect to register.
+       */
+      void
+      schedule(VFXShPtr vfx);
+
+      /**
+       * @brief - Schedule the next step of the elements that were
+       *          due at this step.
+       * @param queue - the queue holding the elements.
+       * @param alarms - the elements stepped. The list is cleared
+       *                 by this method.
+       * @param moment - the time of the step.
+       */
+      void
+      reschedule(WakeUpQueue& queue,
+                 std::vector<WakeUpQueue::Alarm>& alarms,
+                 const utils::TimeStamp& moment);
+
+      /**
+       * @brief - Return the number of chunks needed to step the
+       *          input number of elements.
+       * @param count - the number of elements to step.
+       * @return - the number of chunks.
+       */
+      static unsigned
+      chunks(std::size_t count) noexcept;
+
       /**
        * @brief - Used to process the input list of influences
        *          which usually mean deleting elements marked
@@ -181,6 +370,36 @@ namespace new_frontiers {
       void
       processInfluences();
 
+      /**
+       * @brief - Resolve the damage, harvest and refill influences
+       *          registered during the step. All the influences
+       *          applying to the same element are reduced at once
+       *          so that the result does not depend on the order in
+       *          which elements were stepped:
+       *            - damage is summed and applied to the entity.
+       *            - resources brought to a spawner are added to its
+       *              stock first.
+       *            - resources requested from a deposit or spawner
+       *              are granted in full if the stock allows it or
+       *              shared in proportion of each request otherwise.
+       *          Entities killed are marked for removal.
+       * @param stale - incremented for each influence referring
+       *                to an element which does not exist anymore.
+       * @return - `true` if some entities were killed.
+       */
+      bool
+      resolveExchanges(unsigned& stale);
+
+      /**
+       * @brief - Retrieve the element receiving the exchange
+       *          described by the influence.
+       * @param i - the influence describing the exchange.
+       * @return - the receiver or `null` if it does not exist
+       *           anymore or is not of the expected type.
+       */
+      WorldElement*
+      receiver(const Influence& i) const noexcept;
+
       /**
        * @brief - Attempt to load a world from the file as
        *          specified in input.
@@ -213,6 +432,34 @@ namespace new_frontiers {
 
     private:
 
+      /**
+       * @brief - Convenience structure describing the area of the
+       *          world displayed on screen.
+       */
+      struct Viewport {
+        float xMin;
+        float xMax;
+        float yMin;
+        float yMax;
+      };
+
+      /**
+       * @brief - The phases of a step measured by the profiler.
+       *          The durations of phases split in chunks add up
+       *          the time spent by all threads.
+       */
+      enum Phase {
+        Step,
+        Blocks,
+        Entities,
+        Commit,
+        Effects,
+        Colonies,
+        Influences,
+        Refresh,
+        Reorder
+      };
+
       /**
        * @brief - Convenience define determining which kind of
        *          action is currently `selected`. This means
@@ -242,7 +489,7 @@ namespace new_frontiers {
 
         ActionType type;
 
-        utils::Uuid owner;
+        OwnerId owner;
       };
 
       /**
@@ -258,9 +505,27 @@ namespace new_frontiers {
       /**
        * @brief - The random number engine for this world: allows to
        *          make tthe simulation deterministic by gathering all
-       *          randomness in a single place.
+       *          randomness in a single place. Each element draws
+       *          from its own stream so that the values it gets do
+       *          not depend on the order in which elements are
+       *          processed.
+       */
+      CounterRNG m_rng;
+
+      /**
+       * @brief - The simulation time. It starts at the epoch when
+       *          the world is created and is only advanced by the
+       *          duration of each step, independently of the wall
+       *          clock. This is the time provided to elements in
+       *          the `StepInfo::moment` field.
        */
-      utils::RNG m_rng;
+      utils::TimeStamp m_time;
+
+      /**
+       * @brief - The last identifier assigned to an element of the
+       *          world.
+       */
+      std::uint64_t m_lastId;
 
       /**
        * @brief - The list of colonies registered in the world.
@@ -285,6 +550,96 @@ namespace new_frontiers {
        */
       std::vector<VFXShPtr> m_vfx;
 
+      /**
+       * @brief - The schedule of the steps of blocks. Blocks that
+       *          have nothing to do (e.g. walls) are never stepped.
+       */
+      WakeUpQueue m_blocksQueue;
+
+      /**
+       * @brief - The schedule of the steps of visual effects.
+       */
+      WakeUpQueue m_vfxQueue;
+
+      /**
+       * @brief - Whether evaporating effects are attached to the
+       *          components rather than scheduled in the queue of
+       *          effects.
+       */
+      bool m_useComponents;
+
+      /**
+       * @brief - The number of steps between two checks of the order
+       *          of entities and effects, `0` if they are never
+       *          reordered, and the number of steps since the last
+       *          check.
+       */
+      unsigned m_reorderInterval;
+      unsigned m_sinceReorder;
+
+      /**
+       * @brief - The fraction of consecutive elements which should
+       *          be out of order for a list to be sorted again.
+       */
+      static const float sk_reorderDrift;
+
+      /**
+       * @brief - Holds the state of the evaporating effects when
+       *          the component storage is enabled. Declared after
+       *          the effects so that they outlive it.
+       */
+      Components m_components;
+
+      /**
+       * @brief - The tables associating handles to the blocks, the
+       *          entities and the effects of the world, allowing to
+       *          retrieve them in constant time.
+       */
+      HandleTable<Block> m_blockHandles;
+      HandleTable<Entity> m_entityHandles;
+      HandleTable<VFX> m_vfxHandles;
+
+      /**
+       * @brief - The schedule of the steps of colonies.
+       */
+      WakeUpQueue m_coloniesQueue;
+
+      /**
+       * @brief - The blocks, effects and colonies due at the current
+       *          step. Kept from a step to the next so as to reuse
+       *          the allocated memory.
+       */
+      std::vector<WakeUpQueue::Alarm> m_dueBlocks;
+      std::vector<WakeUpQueue::Alarm> m_dueVFX;
+      std::vector<WakeUpQueue::Alarm> m_dueColonies;
+
+      /**
+       * @brief - Convenience structure describing the exchanges
+       *          requested with a single element during a step.
+       */
+      struct Exchange {
+        // Index of the first influence applying to the element
+        // and the element itself.
+        unsigned first;
+        WorldElement* receiver;
+
+        // Amount brought to the element and amount requested
+        // from it (or damage dealt to it).
+        float supply;
+        float demand;
+
+        // Fraction of the requests which can be granted.
+        float scale;
+      };
+
+      /**
+       * @brief - The exchanges resolved at the current step, in the
+       *          order in which elements are first encountered in
+       *          the influences. Kept from a step to the next so as
+       *          to reuse the allocated memory.
+       */
+      std::vector<Exchange> m_exchanges;
+
       /**
        * @brief - An object to hold all the tiles and entities that
        *          have been registered so far in the world, stored in
@@ -304,6 +659,13 @@ namespace new_frontiers {
        */
       Actions m_actions;
 
+      /**
+       * @brief - The area of the world displayed on screen. It is
+       *          made available to elements so that they can be
+       *          updated more often when visible.
+       */
+      Viewport m_viewport;
+
       /**
        * @brief - List of influences registered for this world. The
        *          influence concept is the main way any game element
@@ -314,8 +676,55 @@ namespace new_frontiers {
        *          possibly find some compromise for some cases like
        *          if several entities are competing to fetch the last
        *          resources from a deposit, etc.
+       *          Influences are stored by value and the list is only
+       *          cleared between steps so that its memory is reused.
+       */
+      std::vector<Influence> m_influences;
+
+      /**
+       * @brief - The number of elements processed by a single unit
+       *          of work when stepping elements.
+       */
+      static const unsigned sk_elementsPerChunk;
+
+      /**
+       * @brief - The pool of threads used to step the elements.
+       */
+      ThreadPoolShPtr m_pool;
+
+      /**
+       * @brief - The phases of a step, described as tasks which
+       *          can run concurrently when they do not access the
+       *          same data.
+       */
+      TaskGraph m_graph;
+
+      /**
+       * @brief - Measures the time spent in each phase of a step.
+       */
+      ProfilerShPtr m_profiler;
+
+      /**
+       * @brief - The influences produced by each chunk of elements
+       *          during a step. Kept from a step to the next so as
+       *          to reuse the allocated memory.
+       */
+      std::vector<std::vector<Influence>> m_chunks;
+
+      /**
+       * @brief - The arena serving the transient containers of
+       *          each chunk of elements, in the same order as the
+       *          influences. They are all reset at the end of a
+       *          step, once no element uses them anymore.
+       */
+      std::vector<std::unique_ptr<Arena>> m_arenas;
+
+      /**
+       * @brief - The arena of the step information created by
+       *          the world itself, also used while processing the
+       *          influences. It is reset at the end of the step.
        */
-      std::vector<InfluenceShPtr> m_influences;
+      Arena m_arena;
   };
 
   using WorldShPtr = std::shared_ptr<World>;
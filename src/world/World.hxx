@@ -28,6 +28,24 @@ namespace new_frontiers {
     return m_loc;
   }
 
+  inline
+  ProfilerShPtr
+  World::profiler() const noexcept {
+    return m_profiler;
+  }
+
+  inline
+  void
+  World::setStepThreads(unsigned threads) {
+    m_pool = std::make_shared<ThreadPool>(threads);
+  }
+
+  inline
+  void
+  World::setViewport(float xMin, float yMin, float xMax, float yMax) {
+    m_viewport = Viewport{xMin, xMax, yMin, yMax};
+  }
+
   inline
   void
   World::setBlockProps(BlockPropsShPtr props) {
@@ -83,10 +101,10 @@ namespace new_frontiers {
     // In case no owner is yet defined, pick
     // the first one (if possible).
     if (m_colonies.empty()) {
-      m_actions.owner.invalidate();
+      m_actions.owner = owner::none;
     }
 
-    if (!m_actions.owner.valid()) {
+    if (!owner::valid(m_actions.owner)) {
       m_actions.owner = m_colonies[0u]->getOwner();
       m_colonies[0u]->setActive(true);
       return;
@@ -102,7 +120,7 @@ namespace new_frontiers {
     if (id >= m_colonies.size()) {
       warn(
         "Could not find colony corresponding to current active one " +
-        m_actions.owner.toString() + ", switching to first one"
+        owner::name(m_actions.owner) + ", switching to first one"
       );
 
       m_actions.owner = m_colonies[0u]->getOwner();
@@ -128,7 +146,7 @@ namespace new_frontiers {
 
     // No owner of any of the items that
     // can be spawned.
-    m_actions.owner.invalidate();
+    m_actions.owner = owner::none;
   }
 
   inline
@@ -136,10 +154,74 @@ namespace new_frontiers {
   World::generate() {
     // Generate elements.
     generateElements();
+    identifyAll();
+    scheduleAll();
 
     // Create the locator service from the
     // elements of this world.
-    m_loc = std::make_shared<Locator>(m_w, m_h, m_blocks, m_entities, m_vfx, m_colonies);
+    m_loc = std::make_shared<Locator>(
+      m_w,
+      m_h,
+      m_blocks,
+      m_entities,
+      m_vfx,
+      m_colonies,
+      m_blockHandles,
+      m_entityHandles,
+      m_vfxHandles,
+      m_components
+    );
+  }
+
+  inline
+  void
+  World::identify(WorldElement& e) noexcept {
+    e.setId(++m_lastId);
+  }
+
+  inline
+  void
+  World::identifyAll() {
+    for (unsigned id = 0u ; id < m_colonies.size() ; ++id) {
+      identify(*m_colonies[id]);
+    }
+
+    for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
+      identify(*m_blocks[id]);
+      m_blockHandles.acquire(m_blocks[id]);
+    }
+
+    for (unsigned id = 0u ; id < m_entities.size() ; ++id) {
+      identify(*m_entities[id]);
+      m_entityHandles.acquire(m_entities[id]);
+    }
+
+    for (unsigned id = 0u ; id < m_vfx.size() ; ++id) {
+      identify(*m_vfx[id]);
+      m_vfxHandles.acquire(m_vfx[id]);
+    }
+  }
+
+  inline
+  unsigned
+  World::chunks(std::size_t count) noexcept {
+    return (count + sk_elementsPerChunk - 1u) / sk_elementsPerChunk;
+  }
+
+  inline
+  void
+  World::scheduleAll() {
+    for (unsigned id = 0u ; id < m_colonies.size() ; ++id) {
+      m_coloniesQueue.insert(m_colonies[id], m_time);
+    }
+
+    for (unsigned id = 0u ; id < m_blocks.size() ; ++id) {
+      m_blocksQueue.insert(m_blocks[id], m_time);
+    }
+
+    for (unsigned id = 0u ; id < m_vfx.size() ; ++id) {
+      schedule(m_vfx[id]);
+    }
   }
 
   inline
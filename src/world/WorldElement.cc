@@ -0,0 +1,61 @@
+
+# include "WorldElement.hh"
+# include <mutex>
+# include <shared_mutex>
+# include <unordered_map>
+
+namespace new_frontiers {
+
+  namespace {
+
+    /**
+     * @brief - The loggers created so far, indexed by their
+     *          name and service. The registry is never deleted
+     *          so that elements can log up until the end of the
+     *          program.
+     */
+    struct Registry {
+      std::shared_mutex locker;
+      std::unordered_map<std::string, std::unique_ptr<ElementLogger>> loggers;
+    };
+
+    Registry&
+    registry() noexcept {
+      static Registry* r = new Registry();
+      return *r;
+    }
+
+  }
+
+  ElementLogger::ElementLogger(const std::string& name,
+                               const std::string& service):
+    utils::CoreObject(name)
+  {
+    setService(service);
+  }
+
+  const ElementLogger&
+  ElementLogger::get(const std::string& name, const std::string& service) {
+    Registry& r = registry();
+    std::string key = name + "/" + service;
+
+    // Elements are mostly created for categories which
+    // already exist.
+    {
+      std::shared_lock<std::shared_mutex> guard(r.locker);
+      auto it = r.loggers.find(key);
+      if (it != r.loggers.cend()) {
+        return *it->second;
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> guard(r.locker);
+    std::unique_ptr<ElementLogger>& l = r.loggers[key];
+    if (l == nullptr) {
+      l = std::make_unique<ElementLogger>(name, service);
+    }
+
+    return *l;
+  }
+
+}
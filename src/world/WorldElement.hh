@@ -1,9 +1,13 @@
 #ifndef    WORLD_ELEMENT_HH
 # define   WORLD_ELEMENT_HH
 
+# include <memory>
+# include <string>
+# include <cstdint>
 # include <core_utils/TimeUtils.hh>
 # include <core_utils/CoreObject.hh>
-# include <core_utils/Uuid.hh>
+# include "Owner.hh"
+# include "Logging.hh"
 
 namespace new_frontiers {
 
@@ -11,9 +15,52 @@ namespace new_frontiers {
   /// in the class definition.
   class StepInfo;
 
-  class WorldElement: public utils::CoreObject {
+  /**
+   * @brief - A logger shared by all the elements of a given
+   *          category. Elements are created in large numbers
+   *          and would otherwise each carry their own name and
+   *          service strings only to be able to log messages.
+   */
+  class ElementLogger: public utils::CoreObject {
     public:
 
+      /**
+       * @brief - Create a new logger for the specified category.
+       * @param name - the name of the elements using the logger.
+       * @param service - the service of the elements.
+       */
+      ElementLogger(const std::string& name,
+                    const std::string& service);
+
+      using utils::CoreObject::getName;
+      using utils::CoreObject::verbose;
+      using utils::CoreObject::debug;
+      using utils::CoreObject::info;
+      using utils::CoreObject::warn;
+      using utils::CoreObject::error;
+
+      /**
+       * @brief - Retrieve the logger for the specified category,
+       *          creating it if needed. Loggers live until the end
+       *          of the program so the returned reference can be
+       *          kept by the elements.
+       * @param name - the name of the elements using the logger.
+       * @param service - the service of the elements.
+       * @return - the shared logger.
+       */
+      static
+      const ElementLogger&
+      get(const std::string& name, const std::string& service);
+  };
+
+  class WorldElement {
+    public:
+
+      /**
+       * @brief - Desctruction of the element.
+       */
+      virtual ~WorldElement() = default;
+
       /**
        * @brief - Interrogate the internal identifier for the
        *          owner of this entity and return `true` if
@@ -24,15 +71,76 @@ namespace new_frontiers {
       isOwned() const noexcept;
 
       /**
-       * @brief - Return a reference to the identifier of the
-       *          owner of this element. Note that the uuid
-       *          might be invalid if the `isOwned` returns
-       *          `true`.
-       * @return - the identifier of the owner of this elem.
+       * @brief - Return the index of the owner of this element.
+       *          Note that the index is `owner::none` in case
+       *          `isOwned` returns `false`.
+       * @return - the index of the owner of this elem.
        */
-      const utils::Uuid&
+      OwnerId
       getOwner() const noexcept;
 
+      /**
+       * @brief - Return the identifier of this element in the
+       *          world. It is assigned when the element is first
+       *          registered in the world and is guaranteed to be
+       *          the same across runs using the same seed. A
+       *          value of `0` indicates that the element is not
+       *          yet registered.
+       * @return - the identifier of this element.
+       */
+      std::uint64_t
+      getId() const noexcept;
+
+      /**
+       * @brief - Assign a new identifier for this element. Only
+       *          meant to be used by the world when registering
+       *          the element.
+       * @param id - the identifier of the element.
+       */
+      void
+      setId(std::uint64_t id) noexcept;
+
+      /**
+       * @brief - The index and generation of the slot of this
+       *          element in the table of handles of the world.
+       *          A null generation indicates that the element
+       *          is not registered.
+       * @return - the slot or generation of this element.
+       */
+      std::uint32_t
+      getSlot() const noexcept;
+
+      std::uint32_t
+      getGeneration() const noexcept;
+
+      /**
+       * @brief - Assign the slot of this element in the table of
+       *          handles of the world. Only meant to be used by
+       *          the table.
+       * @param slot - the index of the slot.
+       * @param generation - the generation of the slot.
+       */
+      void
+      setHandle(std::uint32_t slot, std::uint32_t generation) noexcept;
+
+      /**
+       * @brief - Whether this element has been marked for removal
+       *          from the world. Such elements are discarded when
+       *          the world compacts its lists of elements.
+       * @return - `true` if the element is marked for removal.
+       */
+      bool
+      isRemoved() const noexcept;
+
+      /**
+       * @brief - Mark or unmark this element for removal. Only
+       *          meant to be used by the world when processing
+       *          influences.
+       * @param removed - whether the element should be removed.
+       */
+      void
+      setRemoved(bool removed) noexcept;
+
       /**
        * @brief - Interface method allowing for a world element
        *          to evolve based on its surroundings. We use a
@@ -47,57 +155,143 @@ namespace new_frontiers {
       step(StepInfo& info) = 0;
 
       /**
-       * @brief - Interface method allowing to pause this world
-       *          element: all internal behavior that depend on
-       *          time should be stopped so that they can be
-       *          later resumed.
-       * @param t - the timestamp at which the pause occur.
+       * @brief - Return the next moment at which this element
+       *          needs to be stepped, assuming it has just been
+       *          stepped at `moment`. The world does not step the
+       *          element before this time unless something woke
+       *          it up in the meantime: the `elapsed` duration
+       *          provided at the next step then covers the whole
+       *          period.
+       *          The default implementation requests the element
+       *          to be stepped at each step of the world.
+       * @param moment - the moment of the last step.
+       * @return - the next moment at which to step the element.
        */
-      virtual void
-      pause(const utils::TimeStamp& t) = 0;
-
-      /**
-       * @brief - Opposite operation to the `pause`, this method
-       *          is called to indicate that internal processes
-       *          for this world element can be resumed.
-       * @param t - the timestamp at which the resume occur.
-       */
-      virtual void
-      resume(const utils::TimeStamp& t) = 0;
+      virtual utils::TimeStamp
+      nextWakeUp(const utils::TimeStamp& moment) const noexcept;
 
     protected:
 
       /**
        * @brief - Create a new world element with the specified
-       *          name and owner.
+       *          logger and owner.
        *          The owner can be left empty in order to make
        *          this element independant.
-       * @param name - the name of this element.
-       * @param owner - the owner of this element or an invalid
-       *                identifier if the element is not owned.
+       *          Inheriting classes are expected to look up the
+       *          logger once and keep it rather than querying it
+       *          for each element they create.
+       * @param logger - the logger shared by the elements of the
+       *                 category of this one.
+       * @param owner - the owner of this element or `none` if
+       *                the element is not owned.
        */
-      WorldElement(const std::string& name,
-                   const utils::Uuid& owner = utils::Uuid());
+      WorldElement(const ElementLogger& logger,
+                   OwnerId owner = owner::none);
 
       /**
        * @brief - Used to define a new owner for this element.
-       * @param uuid - the identifier of the new owner of the
-       *               element.
+       * @param owner - the index of the new owner of the element.
        */
       void
-      setOwner(const utils::Uuid& uuid);
+      setOwner(OwnerId owner);
+
+      /**
+       * @brief - Change the logger used by this element, usually
+       *          to use the service of a more specialized class.
+       * @param logger - the new logger of the element.
+       */
+      void
+      setLogger(const ElementLogger& logger) noexcept;
+
+      /**
+       * @brief - The name of the logger of this element, shared
+       *          with all the elements of the same category.
+       * @return - the name of the element.
+       */
+      const std::string&
+      getName() const noexcept;
+
+      /**
+       * @brief - Log messages with the corresponding severity
+       *          through the shared logger of this element.
+       * @param message - the message to log.
+       * @param cause - an optional cause for the message.
+       */
+      void
+      verbose(const std::string& message, const std::string& cause = "") const;
+
+      void
+      debug(const std::string& message, const std::string& cause = "") const;
+
+      void
+      info(const std::string& message, const std::string& cause = "") const;
+
+      void
+      warn(const std::string& message, const std::string& cause = "") const;
+
+      /**
+       * @brief - Raise an error with the specified message and
+       *          cause through the shared logger of this element.
+       * @param message - the message of the error.
+       * @param cause - the cause of the error.
+       */
+      void
+      error(const std::string& message, const std::string& cause = "") const;
 
     private:
 
       /**
-       * @brief - The identifier of the owner of this element.
-       *          It is used to make sure that elements can
-       *          cooperate and identify each other in the
-       *          simulation.
+       * @brief - The logger shared by the elements of the same
+       *          category as this one.
        */
-      utils::Uuid m_owner;
+      const ElementLogger* m_logger;
+
+      /**
+       * @brief - The index of the owner of this element. It is
+       *          used to make sure that elements can cooperate
+       *          and identify each other in the simulation.
+       */
+      OwnerId m_owner;
+
+      /**
+       * @brief - The identifier of this element in the world. It
+       *          is for example used to select the random stream
+       *          of the element.
+       */
+      std::uint64_t m_id;
+
+      /**
+       * @brief - Whether this element is marked for removal from
+       *          the world.
+       */
+      bool m_removed;
+
+      /**
+       * @brief - The slot of this element in the table of handles
+       *          of the world and its generation.
+       */
+      std::uint32_t m_slot;
+      std::uint32_t m_generation;
+
+      /**
+       * @brief - The identifier of the alarm currently scheduled
+       *          for this element in a wake-up queue. Any other
+       *          alarm is outdated. A value of `0` indicates that
+       *          the element is not scheduled.
+       */
+      std::uint64_t m_alarm;
+
+      /**
+       * @brief - The last moment at which this element has been
+       *          stepped by its wake-up queue.
+       */
+      utils::TimeStamp m_stepped;
+
+      friend class WakeUpQueue;
   };
 
+  using WorldElementShPtr = std::shared_ptr<WorldElement>;
+
 }
 
 # include "WorldElement.hxx"
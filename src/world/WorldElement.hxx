@@ -8,28 +8,126 @@ namespace new_frontiers {
   inline
   bool
   WorldElement::isOwned() const noexcept {
-    return m_owner.valid();
+    return owner::valid(m_owner);
   }
 
   inline
-  const utils::Uuid&
+  OwnerId
   WorldElement::getOwner() const noexcept {
     return m_owner;
   }
 
   inline
-  WorldElement::WorldElement(const std::string& name,
-                             const utils::Uuid& owner):
-    utils::CoreObject(name),
+  std::uint64_t
+  WorldElement::getId() const noexcept {
+    return m_id;
+  }
+
+  inline
+  void
+  WorldElement::setId(std::uint64_t id) noexcept {
+    m_id = id;
+  }
+
+  inline
+  std::uint32_t
+  WorldElement::getSlot() const noexcept {
+    return m_slot;
+  }
+
+  inline
+  std::uint32_t
+  WorldElement::getGeneration() const noexcept {
+    return m_generation;
+  }
+
+  inline
+  void
+  WorldElement::setHandle(std::uint32_t slot, std::uint32_t generation) noexcept {
+    m_slot = slot;
+    m_generation = generation;
+  }
+
+  inline
+  bool
+  WorldElement::isRemoved() const noexcept {
+    return m_removed;
+  }
+
+  inline
+  void
+  WorldElement::setRemoved(bool removed) noexcept {
+    m_removed = removed;
+  }
+
+  inline
+  WorldElement::WorldElement(const ElementLogger& logger,
+                             OwnerId owner):
+    m_logger(&logger),
 
-    m_owner(owner)
+    m_owner(owner),
+    m_id(0u),
+    m_removed(false),
+    m_slot(0u),
+    m_generation(0u),
+
+    m_alarm(0u),
+    m_stepped()
   {
   }
 
+  inline
+  utils::TimeStamp
+  WorldElement::nextWakeUp(const utils::TimeStamp& moment) const noexcept {
+    return moment;
+  }
+
+  inline
+  void
+  WorldElement::setOwner(OwnerId owner) {
+    m_owner = owner;
+  }
+
+  inline
+  const std::string&
+  WorldElement::getName() const noexcept {
+    return m_logger->getName();
+  }
+
+  inline
+  void
+  WorldElement::setLogger(const ElementLogger& logger) noexcept {
+    m_logger = &logger;
+  }
+
+  inline
+  void
+  WorldElement::verbose(const std::string& message, const std::string& cause) const {
+    m_logger->verbose(message, cause);
+  }
+
+  inline
+  void
+  WorldElement::debug(const std::string& message, const std::string& cause) const {
+    m_logger->debug(message, cause);
+  }
+
+  inline
+  void
+  WorldElement::info(const std::string& message, const std::string& cause) const {
+    m_logger->info(message, cause);
+  }
+
+  inline
+  void
+  WorldElement::warn(const std::string& message, const std::string& cause) const {
+    m_logger->warn(message, cause);
+  }
+
   inline
   void
-  WorldElement::setOwner(const utils::Uuid& uuid) {
-    m_owner = uuid;
+  WorldElement::error(const std::string& message, const std::string& cause) const {
+    m_logger->error(message, cause);
   }
 
 }
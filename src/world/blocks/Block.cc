@@ -4,8 +4,8 @@
 namespace new_frontiers {
 
   Block::Block(const Props& props,
-               const std::string& name):
-    Element(props.tile, props.radius, props.health, name, props.owner)
+               const ElementLogger& logger):
+    Element(props.tile, props.radius, props.health, logger, props.owner)
   {}
 
 }
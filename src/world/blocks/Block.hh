@@ -2,7 +2,6 @@
 # define   BLOCK_HH
 
 # include <memory>
-# include <core_utils/Uuid.hh>
 # include "Element.hh"
 # include "Tiles.hh"
 # include "StepInfo.hh"
@@ -24,7 +23,7 @@ namespace new_frontiers {
         float radius;
         float health;
 
-        utils::Uuid owner;
+        OwnerId owner;
 
         /**
          * @brief - Used to make the compiler consider this
@@ -39,38 +38,38 @@ namespace new_frontiers {
        *          does nothing.
        * @param info - information about the world.
        */
-      void
-      step(StepInfo& info) override;
-
       /**
-       * @brief - Base implementation for an element which
-       *          does nothing: there are no internal ops
-       *          to pause.
-       * @param t - the timestamp at which the pause occur.
+       * @brief - The handle referring to this block in the world.
+       *          It is invalid until the block is registered.
+       * @return - the handle of this block.
        */
+      BlockHandle
+      getHandle() const noexcept;
+
       void
-      pause(const utils::TimeStamp& t) override;
+      step(StepInfo& info) override;
 
       /**
-       * @brief - Base implementation for an element which
-       *          does nothing: there are no internal ops
-       *          to resume.
-       * @param t - the timestamp at which the resume occur.
+       * @brief - Implementation of the interface method: as the
+       *          base block does nothing it never needs to be
+       *          stepped.
+       * @param moment - the moment of the last step.
+       * @return - the next moment at which to step the block.
        */
-      void
-      resume(const utils::TimeStamp& t) override;
+      utils::TimeStamp
+      nextWakeUp(const utils::TimeStamp& moment) const noexcept override;
 
     protected:
 
       /**
        * @brief - Create a new solid element with the tile
-       *          and name. Only used to forward the args
+       *          and logger. Only used to forward the args
        *          to the base class.
        * @param props - the properties describing the block.
-       * @param name - the name of the object.
+       * @param logger - the logger of the object.
        */
       Block(const Props& props,
-            const std::string& name);
+            const ElementLogger& logger);
 
     private:
 
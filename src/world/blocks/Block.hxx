@@ -9,21 +9,21 @@ namespace new_frontiers {
   Block::Props::~Props() {}
 
   inline
-  void
-  Block::step(StepInfo& /*info*/) {
-    // Nothing to do.
+  BlockHandle
+  Block::getHandle() const noexcept {
+    return BlockHandle(getSlot(), getGeneration());
   }
 
   inline
   void
-  Block::pause(const utils::TimeStamp& /*t*/) {
+  Block::step(StepInfo& /*info*/) {
     // Nothing to do.
   }
 
   inline
-  void
-  Block::resume(const utils::TimeStamp& /*t*/) {
-    // Nothing to do.
+  utils::TimeStamp
+  Block::nextWakeUp(const utils::TimeStamp& /*moment*/) const noexcept {
+    return utils::TimeStamp::max();
   }
 
 }
@@ -21,7 +21,7 @@ namespace new_frontiers {
 
     pp.stock = 10.0f;
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     return pp;
   }
@@ -36,7 +36,7 @@ namespace new_frontiers {
     pp.radius = sk_radius;
     pp.health = sk_health;
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     pp.mob = ent;
     pp.mVariant = 0;
@@ -61,7 +61,7 @@ namespace new_frontiers {
     pp.radius = sk_radius;
     pp.health = sk_health;
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     pp.mob = ent;
     pp.mVariant = 0;
@@ -87,7 +87,7 @@ namespace new_frontiers {
     pp.radius = sk_radius;
     pp.health = sk_health;
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     return pp;
   }
@@ -151,7 +151,9 @@ namespace new_frontiers {
   inline
   BlockShPtr
   BlockFactory::newBlock(const Block::Props& props, const std::string& name) noexcept {
-    return std::shared_ptr<Block>(new Block(props, name));
+    // Generic blocks are only created when loading a
+    // world: the logger can be looked up each time.
+    return std::shared_ptr<Block>(new Block(props, ElementLogger::get(name, "element")));
   }
 
   inline
@@ -2,9 +2,20 @@
 # include "Deposit.hh"
 
 namespace new_frontiers {
+  namespace {
+
+    const ElementLogger&
+    logger() {
+      // Deposits are created by colonies during the game
+      // so the logger is only looked up once.
+      static const ElementLogger& l = ElementLogger::get("deposit", "element");
+      return l;
+    }
+
+  }
 
   Deposit::Deposit(const DProps& props):
-    Block(props, "deposit"),
+    Block(props, logger()),
 
     m_stock(props.stock)
   {}
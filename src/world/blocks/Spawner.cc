@@ -6,9 +6,18 @@
 # include "../entities/EntityFactory.hh"
 
 namespace new_frontiers {
+  namespace {
+
+    const ElementLogger&
+    logger() {
+      static const ElementLogger& l = ElementLogger::get("spawner", "element");
+      return l;
+    }
+
+  }
 
   Spawner::Spawner(const SProps& props):
-    Block(props, "spawner"),
+    Block(props, logger()),
 
     m_mob(props.mob),
     m_type(props.agent),
@@ -18,7 +27,7 @@ namespace new_frontiers {
   {}
 
   EntityShPtr
-  Spawner::spawn(StepInfo& info) noexcept {
+  Spawner::spawn(StepInfo& info) {
     // Spawn the entity within `radius` of the spawner,
     // using the provided rng to pick a point. Don't
     // forget to add the position of the spawner itself.
@@ -49,7 +58,7 @@ namespace new_frontiers {
 
         pp.owner = getOwner();
 
-        mp = std::make_shared<Warrior>(pp);
+        mp = EntityFactory::newWarrior(pp);
         } break;
       case mob::Type::Worker:
         // Assume default type is a worker.
@@ -62,7 +71,7 @@ namespace new_frontiers {
 
         pp.owner = getOwner();
 
-        mp = std::make_shared<Worker>(pp);
+        mp = EntityFactory::newWorker(pp);
         } break;
     }
 
@@ -107,7 +107,7 @@ namespace new_frontiers {
        * @return - a pointer to the created entity.
        */
       EntityShPtr
-      spawn(StepInfo& info) noexcept;
+      spawn(StepInfo& info);
 
       /**
        * @brief - Interface method guaranteed to be called when
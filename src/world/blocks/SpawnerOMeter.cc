@@ -3,6 +3,8 @@
 
 namespace new_frontiers {
 
+  const float SpawnerOMeter::sk_refreshDelay = 0.5f;
+
   SpawnerOMeter::SpawnerOMeter(const SOMProps& props):
     Spawner(props),
 
@@ -12,6 +14,21 @@ namespace new_frontiers {
     m_refill(props.refill)
   {}
 
+  utils::TimeStamp
+  SpawnerOMeter::nextWakeUp(const utils::TimeStamp& moment) const noexcept {
+    // At most one entity is spawned per step.
+    if (m_stock >= m_threshold) {
+      return moment;
+    }
+
+    if (m_refill <= 0.0f) {
+      return utils::TimeStamp::max();
+    }
+
+    float delay = std::min((m_threshold - m_stock) / m_refill, sk_refreshDelay);
+    return moment + std::chrono::duration_cast<utils::Duration>(std::chrono::duration<float>(delay));
+  }
+
   void
   SpawnerOMeter::preSpawn(StepInfo& /*info*/, EntityShPtr /*ent*/) {
     // Decrement the stock.
@@ -66,6 +66,19 @@ namespace new_frontiers {
       float
       getStock() const noexcept;
 
+      /**
+       * @brief - Implementation of the interface method: the
+       *          spawner is woken up when its stock reaches the
+       *          threshold, or before that so that the progress
+       *          it displays stays up to date. A spawner that is
+       *          not refilled on its own sleeps until an entity
+       *          wakes it up by refilling it.
+       * @param moment - the moment of the last step.
+       * @return - the next moment at which to step the spawner.
+       */
+      utils::TimeStamp
+      nextWakeUp(const utils::TimeStamp& moment) const noexcept override;
+
     protected:
 
       /**
@@ -94,6 +107,12 @@ namespace new_frontiers {
 
     private:
 
+      /**
+       * @brief - The longest duration in seconds during which a
+       *          spawner refilling on its own is not stepped.
+       */
+      static const float sk_refreshDelay;
+
       /**
        * @brief - The current stock of resource available in the
        *          spawner. Based on the cost of a single entity
@@ -12,9 +12,9 @@ namespace new_frontiers {
     m_spawned(0),
 
     m_interval(props.interval),
-    m_last(utils::now() - m_interval),
-
-    m_passed(utils::Duration::zero())
+    // The simulation time starts at the epoch so this
+    // allows to spawn right away.
+    m_last(utils::TimeStamp() - m_interval)
   {}
 
   void
@@ -29,11 +29,15 @@ namespace new_frontiers {
        */
       TimedSpawner(const TSProps& props);
 
-      void
-      pause(const utils::TimeStamp& t) override;
-
-      void
-      resume(const utils::TimeStamp& t) override;
+      /**
+       * @brief - Implementation of the interface method: the
+       *          spawner only needs to be stepped when its
+       *          interval expires.
+       * @param moment - the moment of the last step.
+       * @return - the next moment at which to step the spawner.
+       */
+      utils::TimeStamp
+      nextWakeUp(const utils::TimeStamp& moment) const noexcept override;
 
     protected:
 
@@ -79,15 +83,6 @@ namespace new_frontiers {
        *          last by this spawner.
        */
       utils::TimeStamp m_last;
-
-      /**
-       * @brief - Holds the remaining duration before a spawn
-       *          is allowed for this spawner in case a pause
-       *          event occurs. Note that in case the spawner
-       *          is not allowed to spawn anything anymore it
-       *          won't contain anything.
-       */
-      utils::Duration m_passed;
   };
 
   using TimedSpawnerShPtr = std::shared_ptr<TimedSpawner>;
@@ -6,25 +6,13 @@
 namespace new_frontiers {
 
   inline
-  void
-  TimedSpawner::pause(const utils::TimeStamp& t) {
-    // Only save something if the spawner is not
-    // depleted already.
-    m_passed = utils::Duration::zero();
-
-    if (!depleted()) {
-      m_passed = t - m_last;
+  utils::TimeStamp
+  TimedSpawner::nextWakeUp(const utils::TimeStamp& /*moment*/) const noexcept {
+    if (depleted()) {
+      return utils::TimeStamp::max();
     }
-  }
 
-  inline
-  void
-  TimedSpawner::resume(const utils::TimeStamp& t) {
-    // In case the duration saved is not null we
-    // need to restore it.
-    if (m_passed != utils::Duration::zero()) {
-      m_last = t - m_passed;
-    }
+    return m_last + m_interval;
   }
 
   inline
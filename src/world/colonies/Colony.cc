@@ -6,8 +6,12 @@
 
 namespace new_frontiers {
 
+  const float Colony::sk_refreshDelay = 0.5f;
+
   Colony::Colony(const Props& props):
-    WorldElement(props.id.toString(), props.id),
+    // Each colony has its own name so there is nothing
+    // to share with other colonies.
+    WorldElement(ElementLogger::get(props.id.toString(), "colony"), owner::intern(props.id)),
 
     m_home(props.home),
 
@@ -25,8 +29,6 @@ namespace new_frontiers {
 
     m_peaceToWarThreshold(props.warThreshold)
   {
-    setService("colony");
-
     if (!props.id.valid()) {
       error(
         "Unable to create colony from uuid",
@@ -35,6 +37,24 @@ namespace new_frontiers {
     }
   }
 
+  utils::TimeStamp
+  Colony::nextWakeUp(const utils::TimeStamp& moment) const noexcept {
+    float delay = sk_refreshDelay;
+
+    // Wake up as soon as a new portal can be spawned.
+    if (m_size < m_maxSize) {
+      if (m_budget >= m_actionCost) {
+        return moment;
+      }
+
+      if (m_refill > 0.0f) {
+        delay = std::min((m_actionCost - m_budget) / m_refill, delay);
+      }
+    }
+
+    return moment + std::chrono::duration_cast<utils::Duration>(std::chrono::duration<float>(delay));
+  }
+
   void
   Colony::update(const StepInfo& info) {
     // Update the budget available for the colony's
@@ -48,7 +68,7 @@ namespace new_frontiers {
     // reserved space of the colony.
     world::Filter f{getOwner(), false};
     tiles::Entity* te = nullptr;
-    std::vector<EntityShPtr> enemies = info.frustum->getVisible(m_home, m_radius, te, -1, &f);
+    std::pmr::vector<EntityHandle> enemies = info.frustum->getVisible(m_home, m_radius, te, -1, &f, world::Sort::None, info.arena);
 
     // In case the threshold is reached, switch to
     // war mode.
@@ -64,16 +84,16 @@ namespace new_frontiers {
     if (p != m_focus) {
       switch (m_focus) {
         case colony::Priority::War:
-          debug("Colony is now at war");
+          NF_DEBUG("Colony is now at war");
           break;
         case colony::Priority::Expansion:
-          debug("Colony is now at expansion");
+          NF_DEBUG("Colony is now at expansion");
           break;
         case colony::Priority::Consolidation:
-          debug("Colony is now at consolidation");
+          NF_DEBUG("Colony is now at consolidation");
           break;
         default:
-          debug("Colony is now in unknown state");
+          NF_DEBUG("Colony is now in unknown state");
           break;
       }
     }
@@ -104,7 +124,7 @@ namespace new_frontiers {
       info.clampCoord(x, y);
     }
 
-    debug("Spawning portal at " + std::to_string(x) + "x" + std::to_string(y));
+    NF_DEBUG("Spawning portal at " + std::to_string(x) + "x" + std::to_string(y));
 
     // Spawn a block corresponding to the current
     // focus of the colony.
@@ -144,20 +144,16 @@ namespace new_frontiers {
       step(StepInfo& info) override;
 
       /**
-       * @brief - Implementation of the interface method to
-       *          make this `Colony` pause internal processes.
-       * @param t - the timestamp at which the pause occur.
+       * @brief - Implementation of the interface method: the
+       *          colony is woken up when its budget allows to
+       *          take a new action, or before that so that its
+       *          focus and the progress it displays stay up to
+       *          date.
+       * @param moment - the moment of the last step.
+       * @return - the next moment at which to step the colony.
        */
-      void
-      pause(const utils::TimeStamp& t) override;
-
-      /**
-       * @brief - Implementation of the interface method to
-       *          make this `Colony` resume its activity.
-       * @param t - the timestamp at which the resume occur.
-       */
-      void
-      resume(const utils::TimeStamp& t) override;
+      utils::TimeStamp
+      nextWakeUp(const utils::TimeStamp& moment) const noexcept override;
 
     private:
 
@@ -200,6 +196,12 @@ namespace new_frontiers {
 
     private:
 
+      /**
+       * @brief - The longest duration in seconds during which the
+       *          colony is not stepped.
+       */
+      static const float sk_refreshDelay;
+
       /**
        * @brief - The preferred position for this colony. It
        *          will usually mean that the activity for this
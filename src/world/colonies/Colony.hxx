@@ -82,18 +82,6 @@ namespace new_frontiers {
     think(info);
   }
 
-  inline
-  void
-  Colony::pause(const utils::TimeStamp& /*t*/) {
-    // Nothing to do yet.
-  }
-
-  inline
-  void
-  Colony::resume(const utils::TimeStamp& /*t*/) {
-    // Nothing to do yet.
-  }
-
 }
 
 #endif    /* COLONY_HXX */
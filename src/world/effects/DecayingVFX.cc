@@ -9,19 +9,21 @@ namespace new_frontiers {
     m_phases(props.phases),
     m_transition(0u),
 
-    m_next(utils::Duration::zero()),
-    m_decayTimeLeft()
-  {
-    // Adjust the next phase duration if any transitions
-    // is specified.
-    if (!m_phases.empty()) {
-      m_transition = 0u;
-      m_next = utils::now() + m_phases[m_transition];
-    }
-  }
+    m_next(),
+    m_started(false)
+  {}
 
   void
   DecayingVFX::update(StepInfo& info) noexcept {
+    // Start the first phase if needed.
+    if (!m_started) {
+      m_started = true;
+
+      if (m_transition < m_phases.size()) {
+        m_next = info.moment + m_phases[m_transition];
+      }
+    }
+
     // Check whether the vfx should decay in its
     // next form.
     if (info.moment < m_next) {
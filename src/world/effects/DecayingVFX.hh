@@ -26,11 +26,15 @@ namespace new_frontiers {
        */
       DecayingVFX(const DProps& props);
 
-      void
-      pause(const utils::TimeStamp& t) override;
-
-      void
-      resume(const utils::TimeStamp& t) override;
+      /**
+       * @brief - Implementation of the interface method: the
+       *          effect only needs to be stepped when it moves
+       *          to its next phase.
+       * @param moment - the moment of the last step.
+       * @return - the next moment at which to step the effect.
+       */
+      utils::TimeStamp
+      nextWakeUp(const utils::TimeStamp& moment) const noexcept override;
 
     protected:
 
@@ -86,13 +90,12 @@ namespace new_frontiers {
       utils::TimeStamp m_next;
 
       /**
-       * @brief - This duration is used in the case of a `pause`
-       *          operation to save the time that was left on
-       *          the current decay operation. It will be used
-       *          to restore the same amount of decaying time
-       *          when the effect is resumed.
+       * @brief - Whether the first phase of the effect has been
+       *          started. As the simulation time is not known
+       *          when the effect is created this happens during
+       *          the first step.
        */
-      utils::Duration m_decayTimeLeft;
+      bool m_started;
   };
 
 }
@@ -6,27 +6,16 @@
 namespace new_frontiers {
 
   inline
-  void
-  DecayingVFX::pause(const utils::TimeStamp& t) {
-    // In case we're decaying, we need to pause the
-    // process. The metric to determine whether we
-    // are decaying is based on whether the `m_phase`
-    // is in the future.
-    m_decayTimeLeft = utils::Duration::zero();
-
-    if (m_transition < m_phases.size()) {
-      m_decayTimeLeft = m_next - t;
+  utils::TimeStamp
+  DecayingVFX::nextWakeUp(const utils::TimeStamp& moment) const noexcept {
+    // The first phase is started at the first step
+    // and the effect is removed on the step after
+    // the last transition.
+    if (!m_started || m_transition >= m_phases.size()) {
+      return moment;
     }
-  }
 
-  inline
-  void
-  DecayingVFX::resume(const utils::TimeStamp& t) {
-    // In case the decay time left is not `0`, we
-    // have to restore it.
-    if (m_decayTimeLeft != utils::Duration::zero()) {
-      m_next = t + m_decayTimeLeft;
-    }
+    return m_next;
   }
 
   inline
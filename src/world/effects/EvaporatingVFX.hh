@@ -26,6 +26,13 @@ namespace new_frontiers {
        */
       EvaporatingVFX(const EProps& props);
 
+      /**
+       * @brief - The rate at which this effect evaporates.
+       * @return - the evaporation rate in units per second.
+       */
+      float
+      getEvaporation() const noexcept;
+
     protected:
 
       bool
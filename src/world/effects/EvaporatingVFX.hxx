@@ -11,6 +11,12 @@ namespace new_frontiers {
     m_evaporation(std::max(props.evaporation, 0.0f))
   {}
 
+  inline
+  float
+  EvaporatingVFX::getEvaporation() const noexcept {
+    return m_evaporation;
+  }
+
   inline
   bool
   EvaporatingVFX::isTerminated(const utils::TimeStamp& /*moment*/) const noexcept {
@@ -28,7 +28,7 @@ namespace new_frontiers {
 
       static
       PheromonShPtr
-      newPheromon(const Pheromon::PProps& props) noexcept;
+      newPheromon(const Pheromon::PProps& props);
 
     private:
 
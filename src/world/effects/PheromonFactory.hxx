@@ -2,6 +2,7 @@
 # define   PHEROMON_FACTORY_HXX
 
 # include "PheromonFactory.hh"
+# include "Pool.hh"
 
 namespace new_frontiers {
 
@@ -15,7 +16,7 @@ namespace new_frontiers {
 
     pp.amount = 1.0f;
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     static const int b = 1000;
     std::vector<utils::Duration> decay = {
@@ -41,7 +42,7 @@ namespace new_frontiers {
 
     pp.amount = 1.0f;
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     pp.evaporation = 0.1f;
 
@@ -58,7 +59,7 @@ namespace new_frontiers {
 
     pp.amount = 1.0f;
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     pp.evaporation = 0.02f;
 
@@ -87,9 +88,11 @@ namespace new_frontiers {
 
   inline
   PheromonShPtr
-  PheromonFactory::newPheromon(const Pheromon::PProps& props) noexcept {
-    // Evaporation time is fixed for now.
-    return std::make_shared<Pheromon>(props);
+  PheromonFactory::newPheromon(const Pheromon::PProps& props) {
+    // Evaporation time is fixed for now. Pheromons are
+    // emitted continuously by mobs so they are allocated
+    // from a dedicated pool.
+    return pool::make<Pheromon>("pheromons", props);
   }
 
   inline
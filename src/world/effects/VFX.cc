@@ -2,13 +2,27 @@
 # include "VFX.hh"
 
 namespace new_frontiers {
+  namespace {
+
+    const ElementLogger&
+    logger() {
+      // Effects are spawned continuously: share a single
+      // lookup of the logger between all of them.
+      static const ElementLogger& l = ElementLogger::get("vfx", "element");
+      return l;
+    }
+
+  }
 
   VFX::VFX(const Props& props):
     // The health of a VFX is more like a percentage of
     // active component left.
-    Element(props.tile, props.radius, 1.0f, "vfx", props.owner),
+    Element(props.tile, props.radius, 1.0f, logger(), props.owner),
+
+    m_amount(props.amount),
 
-    m_amount(props.amount)
+    m_components(nullptr),
+    m_slot(0u)
   {}
 
 }
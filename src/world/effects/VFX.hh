@@ -3,6 +3,7 @@
 
 # include <memory>
 # include "Element.hh"
+# include "Components.hh"
 # include <core_utils/TimeUtils.hh>
 
 namespace new_frontiers {
@@ -22,7 +23,7 @@ namespace new_frontiers {
 
         float amount;
 
-        utils::Uuid owner;
+        OwnerId owner;
 
         /**
          * @brief - Used to make the compiler consider this
@@ -45,31 +46,30 @@ namespace new_frontiers {
       getAmount() const noexcept;
 
       /**
-       * @brief - Implementation of the interface method to
-       *          make this visual effect evolve.
-       * @param info - the necessary information to describe
-       *               the world's surroundings.
+       * @brief - Whether this effect is attached to components
+       *          which hold its state instead of the effect. It
+       *          should not be stepped in this case.
+       * @return - `true` if the effect is attached.
        */
-      void
-      step(StepInfo& info) override;
+      bool
+      isAttached() const noexcept;
 
       /**
-       * @brief - Base implementation for an element which
-       *          does nothing: there are no internal ops
-       *          to pause.
-       * @param t - the timestamp at which the pause occur.
+       * @brief - The handle referring to this effect in the world.
+       *          It is invalid until the effect is registered.
+       * @return - the handle of this effect.
        */
-      void
-      pause(const utils::TimeStamp& t) override;
+      VFXHandle
+      getHandle() const noexcept;
 
       /**
-       * @brief - Base implementation for an element which
-       *          does nothing: there are no internal ops
-       *          to resume.
-       * @param t - the timestamp at which the resume occur.
+       * @brief - Implementation of the interface method to
+       *          make this visual effect evolve.
+       * @param info - the necessary information to describe
+       *               the world's surroundings.
        */
       void
-      resume(const utils::TimeStamp& t) override;
+      step(StepInfo& info) override;
 
     protected:
 
@@ -140,6 +140,17 @@ namespace new_frontiers {
        *          This vauls is in the range `[0; 1]`.
        */
       float m_amount;
+
+      /**
+       * @brief - The components holding the state of this effect
+       *          if it is attached to some, along with the slot
+       *          of the effect in them. The amount is then read
+       *          from the components.
+       */
+      const Components* m_components;
+      unsigned m_slot;
+
+      friend class Components;
   };
 
   using VFXShPtr = std::shared_ptr<VFX>;
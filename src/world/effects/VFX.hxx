@@ -11,7 +11,19 @@ namespace new_frontiers {
   inline
   float
   VFX::getAmount() const noexcept {
-    return m_amount;
+    return (m_components != nullptr ? m_components->amount(m_slot) : m_amount);
+  }
+
+  inline
+  VFXHandle
+  VFX::getHandle() const noexcept {
+    return VFXHandle(getSlot(), getGeneration());
+  }
+
+  inline
+  bool
+  VFX::isAttached() const noexcept {
+    return m_components != nullptr;
   }
 
   inline
@@ -22,7 +34,7 @@ namespace new_frontiers {
     if (isTerminated(info.moment)) {
       // Mark this vfx for deletion.
       markForDeletion(true);
-      info.removeVFX(this);
+      info.removeVFX(getHandle());
 
       return;
     }
@@ -33,18 +45,6 @@ namespace new_frontiers {
     return;
   }
 
-  inline
-  void
-  VFX::pause(const utils::TimeStamp& /*t*/) {
-    // Nothing to do.
-  }
-
-  inline
-  void
-  VFX::resume(const utils::TimeStamp& /*t*/) {
-    // Nothing to do.
-  }
-
   inline
   void
   VFX::changeAmount(float delta) noexcept {
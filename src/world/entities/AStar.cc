@@ -1,7 +1,10 @@
 
 # include "AStar.hh"
+# include <array>
 # include <deque>
 # include <iterator>
+# include "Trace.hh"
+# include "Logging.hh"
 
 namespace {
 
@@ -32,7 +35,7 @@ namespace {
     bool
     contains(const utils::Point2f& p) const noexcept;
 
-    std::vector<Node>
+    std::array<Node, Count>
     generateNeighbors(const utils::Point2f& target) const noexcept;
 
     int
@@ -56,9 +59,9 @@ namespace {
   }
 
   inline
-  std::vector<Node>
+  std::array<Node, Count>
   Node::generateNeighbors(const utils::Point2f& target) const noexcept {
-    std::vector<Node> neighbors(Count);
+    std::array<Node, Count> neighbors;
 
     utils::Point2f np;
 
@@ -155,49 +158,54 @@ namespace new_frontiers {
 
   AStar::AStar(const utils::Point2f& s,
                const utils::Point2f& e,
-               LocatorShPtr loc):
+               LocatorShPtr loc,
+               std::pmr::memory_resource* arena):
     utils::CoreObject("algo"),
 
     m_start(s),
     m_end(e),
 
-    m_loc(loc)
+    m_loc(loc),
+
+    m_arena(arena)
   {
     setService("astar");
   }
 
   bool
-  AStar::findPath(std::vector<utils::Point2f>& path,
+  AStar::findPath(std::pmr::vector<utils::Point2f>& path,
                   float radius,
                   bool allowLog) const noexcept
   {
     // The code for this algorithm has been taken from the
     // below link:
     // https://en.wikipedia.org/wiki/A*_search_algorithm
-    std::vector<utils::Point2f> out;
+    TRACE_NAMED_ZONE(zone, "astar::findPath");
+
+    std::pmr::vector<utils::Point2f> out(m_arena);
     path.clear();
 
     // The list of nodes that are currently being explored.
-    std::vector<Node> nodes;
-    std::deque<int> openNodes;
+    std::pmr::vector<Node> nodes(m_arena);
+    std::pmr::deque<int> openNodes(m_arena);
     Node init{m_start, 0.0f, utils::d(m_start, m_end)};
     nodes.push_back(init);
     openNodes.push_back(0);
 
     if (allowLog) {
-      verbose(
+      NF_VERBOSE(
         "Starting a* at " + std::to_string(m_start.x()) + "x" + std::to_string(m_start.y()) +
         " to reach " + std::to_string(m_end.x()) + "x" + std::to_string(m_end.y())
       );
     }
 
-    using AssociationMap = std::unordered_map<int, int>;
+    using AssociationMap = std::pmr::unordered_map<int, int>;
 
     // The `cameFrom[i]` defines the index of its parent
     // node, i.e. the node we were traversing when this
     // node was encountered.
-    AssociationMap cameFrom;
-    AssociationMap associations;
+    AssociationMap cameFrom(m_arena);
+    AssociationMap associations(m_arena);
 
     associations[init.hash(m_loc->w())] = 0;
 
@@ -217,7 +225,7 @@ namespace new_frontiers {
       openNodes.pop_front();
 
       if (allowLog) {
-        verbose(
+        NF_VERBOSE(
           "Picked node " + std::to_string(current.p.x()) + "x" + std::to_string(current.p.y()) +
           " with c " + std::to_string(current.c) +
           " h is " + std::to_string(current.h) +
@@ -228,7 +236,7 @@ namespace new_frontiers {
       // In case we reached the goal, stop there.
       if (current.contains(m_end)) {
         if (allowLog) {
-          verbose(
+          NF_VERBOSE(
             "Found path to " + std::to_string(m_end.x()) + "x" + std::to_string(m_end.y()) +
             " with c " + std::to_string(current.c) + ", h " + std::to_string(current.h)
           );
@@ -251,7 +259,7 @@ namespace new_frontiers {
           valid = (utils::d(m_start, out[id]) < radius);
 
           if (!valid && allowLog) {
-            verbose(
+            NF_VERBOSE(
               "Distance from start " + std::to_string(m_start.x()) + "x" + std::to_string(m_start.y()) +
               " to point " + std::to_string(id) + "/" + std::to_string(out.size()) +
               " " + std::to_string(out[id].x()) + "x" + std::to_string(out[id].y()) +
@@ -265,9 +273,12 @@ namespace new_frontiers {
 
         // Copy the path if it is valid.
         if (valid) {
-          std::swap(path, out);
+          path.assign(out.begin(), out.end());
         }
 
+        TRACE_ARG(zone, "nodes", nodes.size());
+        TRACE_ARG(zone, "found", found && valid);
+
         return found && valid;
       }
 
@@ -301,7 +312,7 @@ namespace new_frontiers {
       // the `Ob` so we will just not allow it.
       // We will first determine before processing the
       // neighbors and check the status for each one.
-      std::vector<Node> neighbors = current.generateNeighbors(m_end);
+      std::array<Node, Count> neighbors = current.generateNeighbors(m_end);
 
       float bx = std::floor(current.p.x()) + 0.5f;
       float by = std::floor(current.p.y()) + 0.5f;
@@ -351,7 +362,7 @@ namespace new_frontiers {
 
           if (it != associations.end()) {
             if (allowLog) {
-              verbose(
+              NF_VERBOSE(
                 "Updating " + std::to_string(neighbor.p.x()) + "x" + std::to_string(neighbor.p.y()) +
                 " from c " + std::to_string(nodes[it->second].c) + ", " + std::to_string(nodes[it->second].h) +
                 " (f: " + std::to_string(nodes[it->second].c + nodes[it->second].h) + "," +
@@ -366,7 +377,7 @@ namespace new_frontiers {
           }
           else {
             if (allowLog) {
-              verbose(
+              NF_VERBOSE(
                 "Registering " + std::to_string(neighbor.p.x()) + "x" + std::to_string(neighbor.p.y()) +
                 " with c: " + std::to_string(neighbor.c) + " h: " + std::to_string(neighbor.h) +
                 " (f: " + std::to_string(neighbor.c + neighbor.h) + "," +
@@ -383,26 +394,29 @@ namespace new_frontiers {
     }
 
     // We couldn't reach the goal, the algorithm failed.
+    TRACE_ARG(zone, "nodes", nodes.size());
+    TRACE_ARG(zone, "found", false);
+
     return false;
   }
 
   bool
-  AStar::reconstructPath(const std::unordered_map<int, int>& parents,
+  AStar::reconstructPath(const std::pmr::unordered_map<int, int>& parents,
                          int offset,
-                         std::vector<utils::Point2f>& path,
+                         std::pmr::vector<utils::Point2f>& path,
                          bool allowLog) const noexcept
   {
-    std::vector<utils::Point2f> out;
+    std::pmr::vector<utils::Point2f> out(m_arena);
 
     Node n{m_end, 0.0f, 0.0f};
     int h = n.hash(offset);
-    std::unordered_map<int, int>::const_iterator it = parents.find(h);
+    std::pmr::unordered_map<int, int>::const_iterator it = parents.find(h);
 
     while (it != parents.cend()) {
       n.p = Node::invertHash(h, offset);
 
       if (allowLog) {
-        verbose(
+        NF_VERBOSE(
           "Registering point " + std::to_string(n.p.x()) + "x" + std::to_string(n.p.y()) +
           " with hash " + std::to_string(h) +
           ", parent is " + std::to_string(it->second)
@@ -428,7 +442,7 @@ namespace new_frontiers {
     if (sh == h) {
       // We need to reverse the path as we've built
       // it from the end.
-      for (std::vector<utils::Point2f>::const_reverse_iterator it = out.crbegin() ;
+      for (std::pmr::vector<utils::Point2f>::const_reverse_iterator it = out.crbegin() ;
            it != out.crend() ;
            ++it)
       {
@@ -445,10 +459,10 @@ namespace new_frontiers {
       // from there to the first segment will be
       // valid.
       utils::Point2f pObs(-1.0f, -1.0f);
-      std::vector<utils::Point2f> dummy;
+      std::pmr::vector<utils::Point2f> dummy(m_arena);
 
       if (allowLog) {
-        verbose(
+        NF_VERBOSE(
           "Checking obstruction between " +
           std::to_string(m_start.x()) + "x" + std::to_string(m_start.y()) +
           " and " +
@@ -463,7 +477,7 @@ namespace new_frontiers {
         );
 
         if (allowLog) {
-          verbose(
+          NF_VERBOSE(
             "Registering point " + std::to_string(ip.x()) + "x" + std::to_string(ip.y()) +
             " as path from " + std::to_string(m_start.x()) + "x" + std::to_string(m_start.y()) +
             " to " + std::to_string(path[0].x()) + "x" + std::to_string(path[0].y()) +
@@ -479,7 +493,7 @@ namespace new_frontiers {
   }
 
   void
-  AStar::smoothPath(std::vector<utils::Point2f>& path, bool allowLog) const noexcept {
+  AStar::smoothPath(std::pmr::vector<utils::Point2f>& path, bool allowLog) const noexcept {
     // The basic idea is taken from this very interesting
     // article found in Gamasutra:
     // https://www.gamasutra.com/view/feature/131505/toward_more_realistic_pathfinding.php?page=2
@@ -497,12 +511,12 @@ namespace new_frontiers {
       return;
     }
 
-    std::vector<utils::Point2f> out;
+    std::pmr::vector<utils::Point2f> out(path.get_allocator());
     utils::Point2f p = m_start;
     Node end{m_end, 0.0f, 0.0f};
 
     unsigned id = 0u;
-    std::vector<utils::Point2f> dummy;
+    std::pmr::vector<utils::Point2f> dummy(m_arena);
 
     // Simplify the whole path.
     int count = 0;
@@ -520,7 +534,7 @@ namespace new_frontiers {
         // The path can be reached in a straight line,
         // we can remove the current point.
         if (allowLog) {
-          verbose(
+          NF_VERBOSE(
             "Simplified point " + std::to_string(path[id].x()) + "x" + std::to_string(path[id].y()) +
             " as path from " + std::to_string(p.x()) + "x" + std::to_string(p.y()) +
             " to " + std::to_string(c.x()) + "x" + std::to_string(c.y()) +
@@ -533,7 +547,7 @@ namespace new_frontiers {
         // Can't reach the point from the current start.
         // This segment cannot be simplified further.
         if (allowLog) {
-          verbose(
+          NF_VERBOSE(
             "Can't simplify path from " + std::to_string(p.x()) + "x" + std::to_string(p.y()) +
             " to point " + std::to_string(c.x()) + "x" + std::to_string(c.y()) +
             " (id: " + std::to_string(id) + ", s: " + std::to_string(path.size()) + ")" +
@@ -557,7 +571,7 @@ namespace new_frontiers {
 
     if (allowLog) {
       for (unsigned id = 0u ; id < path.size() ; ++id) {
-        verbose(
+        NF_VERBOSE(
           "Point " + std::to_string(id) + "/" + std::to_string(path.size()) +
           " at " + std::to_string(path[id].x()) + "x" + std::to_string(path[id].y())
         );
@@ -3,6 +3,7 @@
 
 # include <core_utils/CoreObject.hh>
 # include <unordered_map>
+# include <memory_resource>
 # include <maths_utils/Point2.hh>
 # include "Locator.hh"
 
@@ -19,10 +20,13 @@ namespace new_frontiers {
        * @param s - the starting position.
        * @param e - the end position.
        * @param loc - the locator describing the world.
+       * @param arena - the memory resource used for the nodes
+       *                explored by the algorithm.
        */
       AStar(const utils::Point2f& s,
             const utils::Point2f& e,
-            LocatorShPtr loc);
+            LocatorShPtr loc,
+            std::pmr::memory_resource* arena = std::pmr::get_default_resource());
 
       /**
        * @brief - Used to generate the path from the start
@@ -44,7 +48,7 @@ namespace new_frontiers {
        * @return - `true` if a path could be find.
        */
       bool
-      findPath(std::vector<utils::Point2f>& path,
+      findPath(std::pmr::vector<utils::Point2f>& path,
                float radius = 10.0f,
                bool allowLog = false) const noexcept;
 
@@ -66,9 +70,9 @@ namespace new_frontiers {
        * @return - `true` if the path could be reconstructed.
        */
       bool
-      reconstructPath(const std::unordered_map<int, int>& parents,
+      reconstructPath(const std::pmr::unordered_map<int, int>& parents,
                       int offset,
-                      std::vector<utils::Point2f>& path,
+                      std::pmr::vector<utils::Point2f>& path,
                       bool allowLog) const noexcept;
 
       /**
@@ -82,7 +86,7 @@ namespace new_frontiers {
        *                   logged.
        */
       void
-      smoothPath(std::vector<utils::Point2f>& path, bool allowLog) const noexcept;
+      smoothPath(std::pmr::vector<utils::Point2f>& path, bool allowLog) const noexcept;
 
     private:
 
@@ -101,6 +105,12 @@ namespace new_frontiers {
        *          whether a location is obstructed.
        */
       LocatorShPtr m_loc;
+
+      /**
+       * @brief - The memory resource of the containers built
+       *          while searching for a path.
+       */
+      std::pmr::memory_resource* m_arena;
   };
 
 }
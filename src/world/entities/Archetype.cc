@@ -0,0 +1,76 @@
+
+# include "Archetype.hh"
+# include <mutex>
+# include <string>
+# include <core_utils/CoreException.hh>
+
+namespace new_frontiers {
+  namespace archetype {
+
+    namespace details {
+
+      Archetype records[capacity] = {
+        Archetype{
+          1.0f, // Perception.
+          0.0f, // Arrival.
+          0.0f, // Path length.
+
+          0.0f, // Max energy.
+          0.0f, // Refill.
+          0.0f, // Pheromon cost.
+
+          0.0f, // Flee radius.
+          0.0f, // Flee cone span.
+
+          0.0f, // Attack cost.
+          0.0f, // Attack range.
+          0.0f  // Seek for health.
+        }
+      };
+
+      std::atomic_uint registered(1u);
+
+    }
+
+    namespace {
+
+      /**
+       * @brief - Serializes the registrations: readers rely on
+       *          the counter being published after the record.
+       */
+      std::mutex&
+      locker() noexcept {
+        static std::mutex* m = new std::mutex();
+        return *m;
+      }
+
+    }
+
+    ArchetypeId
+    add(const Archetype& a) {
+      std::lock_guard<std::mutex> guard(locker());
+
+      unsigned id = details::registered.load(std::memory_order_relaxed);
+      // Mobs referring to an archetype which could not be
+      // registered would silently use the default one.
+      if (id >= capacity) {
+        throw utils::CoreException(
+          std::string("Unable to register archetype"),
+          std::string("archetype"),
+          std::string("entities"),
+          std::string("Registry is full (") + std::to_string(capacity) + " archetype(s))"
+        );
+      }
+
+      details::records[id] = a;
+      if (details::records[id].perception < 0.0f) {
+        details::records[id].perception = 1.0f;
+      }
+
+      details::registered.store(id + 1u, std::memory_order_release);
+
+      return static_cast<ArchetypeId>(id);
+    }
+
+  }
+}
@@ -0,0 +1,102 @@
+#ifndef    ARCHETYPE_HH
+# define   ARCHETYPE_HH
+
+# include <cstdint>
+
+namespace new_frontiers {
+
+  /**
+   * @brief - The constants shared by all the entities of the same
+   *          kind: they never change during the life of an entity
+   *          so instead of copying them in each instance they are
+   *          registered once and entities only keep the index of
+   *          their archetype.
+   *          Fields which do not make sense for a kind of entity
+   *          (for example the attack range of a worker) are left
+   *          to `0`.
+   */
+  struct Archetype {
+    // Entity: the perception and arrival radius and the
+    // maximum length of a path, in cells.
+    float perception;
+    float arrival;
+    float pathLength;
+
+    // Mob: the maximum energy, its refill rate per second
+    // and the energy needed to emit a pheromon.
+    float maxEnergy;
+    float refill;
+    float pheromonCost;
+
+    // Worker: the distance under which enemies trigger the
+    // flee behavior and the span of the cone (in radians)
+    // in which the worker escapes.
+    float fleeRadius;
+    float fleeConeSpan;
+
+    // Warrior: the energy and range of an attack and the
+    // ratio of health under which it goes back home.
+    float attackCost;
+    float attackRange;
+    float seekForHealth;
+  };
+
+  /**
+   * @brief - Compact identifier of an archetype.
+   */
+  using ArchetypeId = std::uint16_t;
+
+  namespace archetype {
+
+    /**
+     * @brief - The index of the default archetype: all its fields
+     *          are `0` except the perception radius which is `1`.
+     *          It is used for entities created without a specific
+     *          archetype.
+     */
+    constexpr ArchetypeId none = 0u;
+
+    /**
+     * @brief - The maximum number of archetypes that can be
+     *          registered, including the default one.
+     */
+    constexpr unsigned capacity = 64u;
+
+    /**
+     * @brief - Register a new archetype. Archetypes are never
+     *          removed so that the index stays valid until the
+     *          end of the program. A negative perception radius
+     *          is replaced by `1`.
+     *          An error is raised if the registry is full.
+     * @param a - the archetype to register.
+     * @return - the index of the archetype.
+     */
+    ArchetypeId
+    add(const Archetype& a);
+
+    /**
+     * @brief - Retrieve the archetype registered with the input
+     *          index. This does not lock anything so that entities
+     *          can access their constants while being stepped.
+     * @param id - the index of the archetype.
+     * @return - the archetype or the default one if the index is
+     *           unknown.
+     */
+    const Archetype&
+    get(ArchetypeId id) noexcept;
+
+    /**
+     * @brief - The number of archetypes registered so far, the
+     *          default one included.
+     * @return - the number of archetypes.
+     */
+    unsigned
+    count() noexcept;
+
+  }
+
+}
+
+# include "Archetype.hxx"
+
+#endif    /* ARCHETYPE_HH */
@@ -0,0 +1,45 @@
+#ifndef    ARCHETYPE_HXX
+# define   ARCHETYPE_HXX
+
+# include "Archetype.hh"
+# include <atomic>
+
+namespace new_frontiers {
+  namespace archetype {
+
+    namespace details {
+
+      /**
+       * @brief - The registered archetypes. The storage never
+       *          moves so that reading a record does not need
+       *          to lock the registry.
+       */
+      extern Archetype records[capacity];
+
+      /**
+       * @brief - The number of records registered so far.
+       */
+      extern std::atomic_uint registered;
+
+    }
+
+    inline
+    const Archetype&
+    get(ArchetypeId id) noexcept {
+      if (id >= details::registered.load(std::memory_order_acquire)) {
+        return details::records[none];
+      }
+
+      return details::records[id];
+    }
+
+    inline
+    unsigned
+    count() noexcept {
+      return details::registered.load(std::memory_order_acquire);
+    }
+
+  }
+}
+
+#endif    /* ARCHETYPE_HXX */
@@ -1,17 +1,28 @@
 
 # include "Entity.hh"
 # include "Locator.hh"
+# include <cmath>
+# include <algorithm>
 # include <maths_utils/LocationUtils.hh>
 
 namespace new_frontiers {
+  namespace {
+
+    const ElementLogger&
+    logger() {
+      // Looked up once for all the entities: spawning one
+      // does not need to access the registry of loggers.
+      static const ElementLogger& l = ElementLogger::get("entity", "element");
+      return l;
+    }
+
+  }
 
   Entity::Entity(const Props& props):
-    Element(props.tile, props.radius, props.health, "entity", props.owner),
+    Element(props.tile, props.radius, props.health, logger(), props.owner),
 
     m_speed(-1.0f),
-    m_perceptionRadius(props.perception < 0.0f ? 1.0f : props.perception),
-    m_rArrival(props.arrival),
-    m_pathLength(props.pathLength),
+    m_archetype(props.archetype),
 
     m_path(path::newPath(m_tile.p)),
 
@@ -20,9 +31,20 @@ namespace new_frontiers {
       false  // Exhausted.
     },
 
-    m_passed()
+    m_components(nullptr),
+    m_slot(0u)
   {
-    // Nothing to do.
+    // Paths selected during a step are copied into the
+    // path of the entity: make room for a path spanning
+    // the farthest distance the entity usually travels
+    // at once, with a few passage points per cell. The
+    // longer paths grow it once and it then keeps its
+    // capacity.
+    const Archetype& a = getArchetype();
+    unsigned cells = static_cast<unsigned>(std::ceil(std::max(a.pathLength, a.perception)));
+
+    m_path.segments.reserve(2u * cells);
+    m_path.cPoints.reserve(6u * cells + 1u);
   }
 
   void
@@ -38,14 +60,15 @@ namespace new_frontiers {
     // behaviors.
     choosePath(info);
 
-    // Move along the path.
-    if (m_path.enRoute(m_rArrival)) {
+    // Move along the path: entities attached to the
+    // components are moved by them.
+    if (!isAttached() && m_path.enRoute(getArchetype().arrival)) {
       // We know the elapsed time since the
       // last frame, we know the speed of
       // the entity, we can determine the
-      // new position.
-      m_path.advance(m_speed, info.elapsed, m_rArrival);
-      m_tile.p = m_path.cur;
+      // new position. Note that it will only
+      // be published when `commit` is called.
+      m_path.advance(m_speed, info.elapsed, getArchetype().arrival);
     }
 
     // Perform post step operations.
@@ -6,6 +6,7 @@
 # include "../effects/Pheromon.hh"
 # include <core_utils/TimeUtils.hh>
 # include "Path.hh"
+# include "Archetype.hh"
 
 namespace new_frontiers {
 
@@ -32,13 +33,11 @@ namespace new_frontiers {
         EntityTile tile;
         float radius;
 
-        float perception;
         float health;
 
-        float arrival;
-        float pathLength;
+        ArchetypeId archetype;
 
-        utils::Uuid owner;
+        OwnerId owner;
 
         /**
          * @brief - Used to make the compiler consider this
@@ -75,9 +74,25 @@ namespace new_frontiers {
       const State&
       getState() const noexcept;
 
+      /**
+       * @brief - The handle referring to this entity in the world.
+       *          It is invalid until the entity is registered.
+       * @return - the handle of this entity.
+       */
+      EntityHandle
+      getHandle() const noexcept;
+
       float
       getPerceptionRadius() const noexcept;
 
+      /**
+       * @brief - The constants shared by all the entities of the
+       *          same kind as this one.
+       * @return - the archetype of this entity.
+       */
+      const Archetype&
+      getArchetype() const noexcept;
+
       /**
        * @brief - Returns the current path followed by the entity.
        * @return - the current path followed by the entity.
@@ -94,6 +109,23 @@ namespace new_frontiers {
       bool
       isEnRoute() const noexcept;
 
+      /**
+       * @brief - Whether this entity is attached to components.
+       * @return - `true` if the entity is attached.
+       */
+      bool
+      isAttached() const noexcept;
+
+      /**
+       * @brief - Used to publish the position reached by this
+       *          entity during the last call to `step`. Until
+       *          this method is called the rest of the world
+       *          still sees the entity at its previous spot,
+       *          which allows to step entities concurrently.
+       */
+      void
+      commit() noexcept;
+
     protected:
 
       /**
@@ -117,7 +149,7 @@ namespace new_frontiers {
        *           that this entity has about VFX.
        */
       PheromonShPtr
-      spawnPheromon(const pheromon::Type& type) const noexcept;
+      spawnPheromon(const pheromon::Type& type) const;
 
       /**
        * @brief - Interface method guaranteed to be called as
@@ -173,25 +205,11 @@ namespace new_frontiers {
       float m_speed;
 
       /**
-       * @brief - Definition of the perception radius that
-       *          this entity has. It is expressed in units
-       *          of the world.
-       *          We make sure that this value is at least
-       *          a positive value.
-       */
-      float m_perceptionRadius;
-
-      /**
-       * @brief - Defines the arrival radius for this entity when
-       *          approaching its destination.
+       * @brief - The index of the archetype holding the constants
+       *          of this entity (perception radius, arrival radius,
+       *          etc.).
        */
-      float m_rArrival;
-
-      /**
-       * @brief - The maximum length for a path selected by this
-       *          entity. Expressed in cells.
-       */
-      float m_pathLength;
+      ArchetypeId m_archetype;
 
       /**
        * @brief - The current path followed by this entity.
@@ -204,12 +222,16 @@ namespace new_frontiers {
       State m_state;
 
       /**
-       * @brief - Save of the duration that passed since the
-       *          current path has been started. Allows to
-       *          save the progression upon a pause event to
-       *          restore it when a resume occurs.
+       * @brief - The components holding the position and the
+       *          energy of this entity if it is attached to some,
+       *          along with the slot of the entity in them. The
+       *          motion along the path is then performed by the
+       *          components.
        */
-      utils::Duration m_passed;
+      Components* m_components;
+      unsigned m_slot;
+
+      friend class Components;
   };
 
   using EntityShPtr = std::shared_ptr<Entity>;
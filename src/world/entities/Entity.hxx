@@ -9,6 +9,12 @@ namespace new_frontiers {
   inline
   Entity::Props::~Props() {}
 
+  inline
+  EntityHandle
+  Entity::getHandle() const noexcept {
+    return EntityHandle(getSlot(), getGeneration());
+  }
+
   inline
   const State&
   Entity::getState() const noexcept {
@@ -18,7 +24,13 @@ namespace new_frontiers {
   inline
   float
   Entity::getPerceptionRadius() const noexcept {
-    return m_perceptionRadius;
+    return getArchetype().perception;
+  }
+
+  inline
+  const Archetype&
+  Entity::getArchetype() const noexcept {
+    return archetype::get(m_archetype);
   }
 
   inline
@@ -30,7 +42,19 @@ namespace new_frontiers {
   inline
   bool
   Entity::isEnRoute() const noexcept {
-    return m_path.enRoute(m_rArrival);
+    return m_path.enRoute(getArchetype().arrival);
+  }
+
+  inline
+  bool
+  Entity::isAttached() const noexcept {
+    return m_components != nullptr;
+  }
+
+  inline
+  void
+  Entity::commit() noexcept {
+    m_tile.p = m_path.cur;
   }
 
   inline
@@ -47,7 +71,7 @@ namespace new_frontiers {
 
   inline
   PheromonShPtr
-  Entity::spawnPheromon(const pheromon::Type& type) const noexcept {
+  Entity::spawnPheromon(const pheromon::Type& type) const {
     Pheromon::PProps pp = PheromonFactory::newPheromonProps(m_tile.p.x(), m_tile.p.y(), type);
 
     pp.radius = getRadius();
@@ -11,4 +11,76 @@ namespace new_frontiers {
   const float EntityFactory::sk_arrival = 0.01f;
   const float EntityFactory::sk_pathLength = 3.0f;
 
+  ArchetypeId
+  EntityFactory::entityArchetype() {
+    static const ArchetypeId id = archetype::add(
+      Archetype{
+        sk_perception,
+        sk_arrival,
+        sk_pathLength,
+
+        0.0f, // Max energy.
+        0.0f, // Refill.
+        0.0f, // Pheromon cost.
+
+        0.0f, // Flee radius.
+        0.0f, // Flee cone span.
+
+        0.0f, // Attack cost.
+        0.0f, // Attack range.
+        0.0f  // Seek for health.
+      }
+    );
+
+    return id;
+  }
+
+  ArchetypeId
+  EntityFactory::workerArchetype() {
+    static const ArchetypeId id = archetype::add(
+      Archetype{
+        sk_perception,
+        sk_arrival,
+        sk_pathLength,
+
+        2.1f, // Max energy.
+        1.0f, // Refill.
+        2.0f, // Pheromon cost.
+
+        1.5f,                 // Flee radius.
+        3.1415926535f / 4.0f, // Flee cone span.
+
+        0.0f, // Attack cost.
+        0.0f, // Attack range.
+        0.0f  // Seek for health.
+      }
+    );
+
+    return id;
+  }
+
+  ArchetypeId
+  EntityFactory::warriorArchetype() {
+    static const ArchetypeId id = archetype::add(
+      Archetype{
+        sk_perception,
+        sk_arrival,
+        sk_pathLength,
+
+        2.1f, // Max energy.
+        1.0f, // Refill.
+        2.0f, // Pheromon cost.
+
+        0.0f, // Flee radius.
+        0.0f, // Flee cone span.
+
+        1.0f,  // Attack cost.
+        0.25f, // Attack range.
+        0.2f   // Seek for health.
+      }
+    );
+
+    return id;
+  }
+
 }
@@ -6,6 +6,7 @@
 # include "Worker.hh"
 # include "Warrior.hh"
 # include "Player.hh"
+# include "Archetype.hh"
 
 namespace new_frontiers {
 
@@ -43,7 +44,36 @@ namespace new_frontiers {
        */
       static
       EntityShPtr
-      newEntityFromProps(const Entity::Props& props) noexcept;
+      newEntityFromProps(const Entity::Props& props);
+
+      /**
+       * @brief - Create a new worker from the input properties.
+       *          Workers are allocated from a dedicated pool as
+       *          they are spawned continuously.
+       * @param props - the properties of the worker.
+       * @return - the created worker.
+       */
+      static
+      WorkerShPtr
+      newWorker(const Worker::WProps& props);
+
+      /**
+       * @brief - Similar to `newWorker` but for a warrior.
+       * @param props - the properties of the warrior.
+       * @return - the created warrior.
+       */
+      static
+      WarriorShPtr
+      newWarrior(const Warrior::WProps& props);
+
+      /**
+       * @brief - Similar to `newWorker` but for a player.
+       * @param props - the properties of the player.
+       * @return - the created player.
+       */
+      static
+      PlayerShPtr
+      newPlayer(const Player::PProps& props);
 
     private:
 
@@ -51,6 +81,25 @@ namespace new_frontiers {
       EntityTile
       newTile(const tiles::Entity& e, int id, float x, float y) noexcept;
 
+      /**
+       * @brief - The archetypes of the entities created by the
+       *          factory. Each one is registered the first time
+       *          it is requested and then shared by all the
+       *          entities of its kind.
+       * @return - the index of the archetype.
+       */
+      static
+      ArchetypeId
+      entityArchetype();
+
+      static
+      ArchetypeId
+      workerArchetype();
+
+      static
+      ArchetypeId
+      warriorArchetype();
+
     private:
 
       static const float sk_radius;
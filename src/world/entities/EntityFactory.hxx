@@ -2,6 +2,7 @@
 # define   ENTITY_FACTORY_HXX
 
 # include "EntityFactory.hxx"
+# include "Pool.hh"
 
 namespace new_frontiers {
 
@@ -13,13 +14,11 @@ namespace new_frontiers {
     pp.tile = newTile(ent, 0, x, y);
     pp.radius = sk_radius;
 
-    pp.perception = sk_perception;
     pp.health = sk_health;
 
-    pp.arrival = sk_arrival;
-    pp.pathLength = sk_pathLength;
+    pp.archetype = entityArchetype();
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     return pp;
   }
@@ -32,13 +31,11 @@ namespace new_frontiers {
     pp.tile = newTile(ent, 0, x, y);
     pp.radius = sk_radius;
 
-    pp.perception = sk_perception;
     pp.health = sk_health;
 
-    pp.arrival = sk_arrival;
-    pp.pathLength = sk_pathLength;
+    pp.archetype = workerArchetype();
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     pp.homeX = x;
     pp.homeY = y;
@@ -47,12 +44,6 @@ namespace new_frontiers {
     pp.cargo = 10.0f;
 
     pp.energy = 1.9f;
-    pp.maxEnergy = 2.1f;
-    pp.refill = 1.0f;
-    pp.pheromonCost = 2.0f;
-
-    pp.fleeRadius = 1.5f;
-    pp.fleeConeSpan = 3.1415926535f / 4.0f;
 
     return pp;
   }
@@ -65,13 +56,11 @@ namespace new_frontiers {
     pp.tile = newTile(ent, 0, x, y);
     pp.radius = sk_radius;
 
-    pp.perception = sk_perception;
     pp.health = sk_health;
 
-    pp.arrival = sk_arrival;
-    pp.pathLength = sk_pathLength;
+    pp.archetype = warriorArchetype();
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     pp.homeX = x;
     pp.homeY = y;
@@ -80,15 +69,8 @@ namespace new_frontiers {
     pp.cargo = 10.0f;
 
     pp.energy = 1.9f;
-    pp.maxEnergy = 2.1f;
-    pp.refill = 1.0f;
-    pp.pheromonCost = 2.0f;
 
     pp.attack = 2.0f;
-    pp.attackCost = 1.0f;
-    pp.attackRange = 0.25f;
-
-    pp.seekForHealth = 0.2f;
 
     return pp;
   }
@@ -101,13 +83,11 @@ namespace new_frontiers {
     pp.tile = newTile(ent, 0, x, y);
     pp.radius = 2.0f * sk_radius;
 
-    pp.perception = sk_perception;
     pp.health = sk_health;
 
-    pp.arrival = sk_arrival;
-    pp.pathLength = sk_pathLength;
+    pp.archetype = entityArchetype();
 
-    pp.owner.invalidate();
+    pp.owner = owner::none;
 
     pp.sprintSpeed = 4.0f;
     pp.recoverySpeed = 0.5f;
@@ -120,7 +100,7 @@ namespace new_frontiers {
 
   inline
   EntityShPtr
-  EntityFactory::newEntityFromProps(const Entity::Props& props) noexcept {
+  EntityFactory::newEntityFromProps(const Entity::Props& props) {
     // Attempt to convert the input properties into
     // known types. Note that we should perform the
     // most derived types first otherwise we won't
@@ -129,17 +109,17 @@ namespace new_frontiers {
 
     const Warrior::WProps* wp = dynamic_cast<const Warrior::WProps*>(pp);
     if (wp != nullptr) {
-      return std::make_shared<Warrior>(*wp);
+      return newWarrior(*wp);
     }
 
     const Worker::WProps* wp2 = dynamic_cast<const Worker::WProps*>(pp);
     if (wp2 != nullptr) {
-      return std::make_shared<Worker>(*wp2);
+      return newWorker(*wp2);
     }
 
     const Player::PProps* plp = dynamic_cast<const Player::PProps*>(pp);
     if (plp != nullptr) {
-      return std::make_shared<Player>(*plp);
+      return newPlayer(*plp);
     }
 
     // Can't interpret the props, return an invalid
@@ -153,6 +133,24 @@ namespace new_frontiers {
     return EntityTile{utils::Point2f(x, y), e, id};
   }
 
+  inline
+  WorkerShPtr
+  EntityFactory::newWorker(const Worker::WProps& props) {
+    return pool::make<Worker>("workers", props);
+  }
+
+  inline
+  WarriorShPtr
+  EntityFactory::newWarrior(const Warrior::WProps& props) {
+    return pool::make<Warrior>("warriors", props);
+  }
+
+  inline
+  PlayerShPtr
+  EntityFactory::newPlayer(const Player::PProps& props) {
+    return pool::make<Player>("players", props);
+  }
+
 }
 
 #endif    /* ENTITY_FACTORY_HXX */
@@ -1,11 +1,17 @@
 
 # include "Mob.hh"
 # include "Locator.hh"
+# include "Trace.hh"
 # include "../blocks/Deposit.hh"
 # include "../blocks/SpawnerOMeter.hh"
 
 namespace new_frontiers {
 
+  const float Mob::sk_thinkEnRoute = 0.5f;
+  const float Mob::sk_thinkIdle = 0.25f;
+  const float Mob::sk_thinkOnScreen = 0.1f;
+  const float Mob::sk_thinkNearEnemies = 0.05f;
+
   Mob::Mob(const MProps& props):
     Entity(props),
 
@@ -15,15 +21,21 @@ namespace new_frontiers {
     m_cargo(std::max(props.cargo, 0.0f)),
 
     m_energy(props.energy),
-    m_maxEnergy(props.maxEnergy),
-    m_energyRefill(props.refill),
-    m_pheromonCost(props.pheromonCost),
 
-    m_behavior(Behavior::Wander)
+    m_behavior(Behavior::Wander),
+
+    m_thinkDelay(0.0f),
+    m_idle(true)
   {}
 
   bool
   Mob::takeAction(StepInfo& info, path::Path& path) {
+    // Only re-evaluate the behavior when needed: in
+    // the meantime the mob keeps following its path.
+    if (!shouldThink(info)) {
+      return false;
+    }
+
     // First, we need to update the behavior of the
     // entity: it is relevant because we just reached
     // the destination we previously picked.
@@ -42,9 +54,34 @@ namespace new_frontiers {
       path = t.path;
     }
 
+    scheduleThink(info);
+
     return t.actionTaken;
   }
 
+  void
+  Mob::scheduleThink(StepInfo& info) noexcept {
+    m_idle = !isEnRoute();
+
+    // Mobs perceiving enemies should react quickly
+    // while others can wait a bit, unless they are
+    // displayed. We check what the mob can actually
+    // see rather than its behavior: a mob which is
+    // not chasing or fleeing yet should still react
+    // to an enemy walking up to it.
+    float delay = (m_idle ? sk_thinkIdle : sk_thinkEnRoute);
+
+    world::Filter f{getOwner(), false};
+    if (info.frustum->countEntities(m_tile.p, getArchetype().perception, &f) > 0u) {
+      delay = sk_thinkNearEnemies;
+    }
+    else if (info.onScreen(m_tile.p)) {
+      delay = std::min(delay, sk_thinkOnScreen);
+    }
+
+    m_thinkDelay = delay * info.rng.rndFloat(0.5f, 1.0f);
+  }
+
   void
   Mob::pickRandomTarget(StepInfo& info,
                         const utils::Point2f& r,
@@ -98,11 +135,8 @@ namespace new_frontiers {
   bool
   Mob::wanderToDeposit(StepInfo& info, path::Path& path) noexcept {
     // Locate the closest deposit if any.
-    BlockShPtr deposit = info.frustum->getClosest(path.cur, tiles::Portal, m_perceptionRadius, 14);
-    DepositShPtr d = nullptr;
-    if (deposit != nullptr) {
-      d = std::dynamic_pointer_cast<Deposit>(deposit);
-    }
+    BlockHandle deposit = info.frustum->getClosest(path.cur, tiles::Portal, getArchetype().perception, 14, nullptr, info.arena);
+    Deposit* d = dynamic_cast<Deposit*>(info.frustum->resolve(deposit));
 
     if (d == nullptr || d->getStock() <= 0.0f) {
       // No deposit could be found: we will
@@ -114,7 +148,7 @@ namespace new_frontiers {
       }
 
       if (d != nullptr && d->getStock() <= 0.0f) {
-        debug("Deposit is empty");
+        NF_DEBUG("Deposit is empty");
       }
 
       pickTargetFromPheromon(info, path, Goal::Deposit);
@@ -126,13 +160,13 @@ namespace new_frontiers {
     p.x() += 0.5f;
     p.y() += 0.5f;
 
-    debug(
+    NF_DEBUG(
       "Entity at " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()) +
       " found deposit at " + std::to_string(p.x()) + "x" + std::to_string(p.y()) +
       " d: " + std::to_string(utils::d(m_tile.p, p))
     );
 
-    if (!path.generatePathTo(info, p, true, m_perceptionRadius)) {
+    if (!path.generatePathTo(info, p, true, getArchetype().perception)) {
       return false;
     }
 
@@ -147,7 +181,9 @@ namespace new_frontiers {
   Mob::wanderToHome(StepInfo& info, path::Path& path) noexcept {
     // Locate the closest deposit if any.
     world::Filter f{getOwner(), true};
-    BlockShPtr b = info.frustum->getClosest(m_tile.p, tiles::Portal, m_perceptionRadius, -1, &f);
+    Block* b = info.frustum->resolve(
+      info.frustum->getClosest(m_tile.p, tiles::Portal, getArchetype().perception, -1, &f, info.arena)
+    );
 
     if (b == nullptr) {
       // The home can't be found: we will
@@ -158,7 +194,7 @@ namespace new_frontiers {
         return false;
       }
 
-      debug("Home is too far, can't see it");
+      NF_DEBUG("Home is too far, can't see it");
 
       pickTargetFromPheromon(info, path, Goal::Home);
       return true;
@@ -169,13 +205,13 @@ namespace new_frontiers {
     p.x() += 0.5f;
     p.y() += 0.5f;
 
-    debug(
+    NF_DEBUG(
       "Entity at " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()) +
       " found home at " + std::to_string(p.x()) + "x" + std::to_string(p.y()) +
       " d: " + std::to_string(utils::d(m_tile.p, p))
     );
 
-    if (!path.generatePathTo(info, p, true, m_perceptionRadius)) {
+    if (!path.generatePathTo(info, p, true, getArchetype().perception)) {
       return false;
     }
 
@@ -191,7 +227,7 @@ namespace new_frontiers {
     // Locate the closest entity if any.
     world::Filter f{getOwner(), false};
     tiles::Entity* te = nullptr;
-    std::vector<EntityShPtr> entities = info.frustum->getVisible(m_tile.p, m_perceptionRadius, te, -1, &f, world::Sort::Distance);
+    std::pmr::vector<EntityHandle> entities = info.frustum->getVisible(m_tile.p, getArchetype().perception, te, -1, &f, world::Sort::Distance, info.arena);
 
     // In case there are no entities, continue the
     // wandering around process.
@@ -202,7 +238,7 @@ namespace new_frontiers {
         return false;
       }
 
-      debug("Entity is home alone, no friends nearby");
+      NF_DEBUG("Entity is home alone, no friends nearby");
 
       pickTargetFromPheromon(info, path, Goal::Entity);
       return true;
@@ -210,13 +246,13 @@ namespace new_frontiers {
 
     // Pick the first one as it will be the closest
     // and attempt to find a path to reach it.
-    EntityShPtr e = entities.front();
+    Entity* e = info.frustum->resolve(entities.front());
 
-    if (!path.generatePathTo(info, e->getTile().p, false, m_perceptionRadius)) {
+    if (e == nullptr || !path.generatePathTo(info, e->getTile().p, false, getArchetype().perception)) {
       return false;
     }
 
-    debug(
+    NF_DEBUG(
       "Entity at " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()) +
       " found ennemy at " + std::to_string(e->getTile().p.x()) + "x" + std::to_string(e->getTile().p.y()) +
       " d: " + std::to_string(utils::d(m_tile.p, e->getTile().p))
@@ -231,7 +267,7 @@ namespace new_frontiers {
 
   bool
   Mob::returnToWandering(StepInfo& info,
-                         std::function<bool(VFXShPtr)> filter,
+                         std::function<bool(const VFX&)> filter,
                          PheromonAnalyzer& analyzer,
                          path::Path& path,
                          unsigned attempts)
@@ -240,29 +276,23 @@ namespace new_frontiers {
     // the entity: this will be filtered afterwards using
     // the provided function.
     tiles::Effect* te = nullptr;
-    std::vector<VFXShPtr> allVFXs = info.frustum->getVisible(m_tile.p, m_perceptionRadius, te, -1, nullptr);
-
-    std::vector<VFXShPtr> vfxs;
-    for (unsigned id = 0u ; id < allVFXs.size() ; ++id) {
-      if (!filter(allVFXs[id])) {
-        vfxs.push_back(allVFXs[id]);
-      }
-    }
+    std::pmr::vector<VFXHandle> vfxs = info.frustum->getVisible(m_tile.p, getArchetype().perception, te, -1, nullptr, world::Sort::None, info.arena);
 
     // Accumulate the visible pheromons in the analyzer
     // to be able to pick a direction that is influenced
     // by them.
-    if (!vfxs.empty()) {
-      for (unsigned id = 0u ; id < vfxs.size() ; ++id) {
-        VFXShPtr v = vfxs[id];
-
-        PheromonShPtr p = std::dynamic_pointer_cast<Pheromon>(v);
-        if (v == nullptr || p == nullptr) {
-          continue;
-        }
+    for (unsigned id = 0u ; id < vfxs.size() ; ++id) {
+      VFX* v = info.frustum->resolve(vfxs[id]);
+      if (v == nullptr || filter(*v)) {
+        continue;
+      }
 
-        analyzer.accumulate(*p);
+      Pheromon* p = dynamic_cast<Pheromon*>(v);
+      if (p == nullptr) {
+        continue;
       }
+
+      analyzer.accumulate(*p);
     }
 
     // Attempt to pick a random target (as the final
@@ -274,10 +304,10 @@ namespace new_frontiers {
     utils::Point2f p;
     bool generated = false;
     unsigned tries = 0u;
-    path::Path newP = path::newPath(m_tile.p);
+    path::Path newP = path::newPath(m_tile.p, info.arena);
 
     while (!generated && tries < attempts) {
-      pickRandomTarget(info, m_tile.p, m_pathLength, xRnd, yRnd);
+      pickRandomTarget(info, m_tile.p, getArchetype().pathLength, xRnd, yRnd);
       analyzer.computeTarget(xRnd, yRnd);
 
       p.x() = xRnd;
@@ -291,9 +321,11 @@ namespace new_frontiers {
     // Whatever happens we will be in `Wander` behavior.
     setBehavior(Behavior::Wander);
 
-    // In case the path could not be generated, wait.
+    // In case the path could not be generated, wait:
+    // a mob which is boxed in fails at each of its
+    // evaluations so this is not reported as warning.
     if (!generated) {
-      warn(
+      NF_VERBOSE(
         "Failed to generate path from " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()) +
         " after " + std::to_string(tries) + " attempt(s)"
       );
@@ -301,7 +333,7 @@ namespace new_frontiers {
       return false;
     }
 
-    std::swap(path, newP);
+    path = newP;
     return true;
   }
 
@@ -312,16 +344,16 @@ namespace new_frontiers {
   {
     // Generate the pheromon analyzer and the
     // filtering method for pheromons.
-    PheromonAnalyzer pa = generateFromGoal(priority);
+    PheromonAnalyzer pa = generateFromGoal(priority, info.arena);
 
-    utils::Uuid owner = getOwner();
-    auto filter = [&owner](VFXShPtr vfx) {
-      return vfx->getOwner() != owner;
+    OwnerId owner = getOwner();
+    auto filter = [owner](const VFX& vfx) {
+      return vfx.getOwner() != owner;
     };
 
     // Use the dedicated handler.
     if (!returnToWandering(info, filter, pa, path)) {
-      warn("Unable to return to wandering, path could not be generated");
+      NF_VERBOSE("Unable to return to wandering, path could not be generated");
     }
   }
 
@@ -330,9 +362,10 @@ namespace new_frontiers {
     // Save the current behavior.
     Behavior s = m_behavior;
 
-    Thought t;
-    t.behaviorChanged = false;
-    t.actionTaken = false;
+    TRACE_ZONE_ARG(zone, "mob::behave", "entity", getId());
+    TRACE_ARG(zone, "behavior", s);
+
+    Thought t{false, false, path::newPath(m_tile.p, info.arena)};
     t.path = path;
 
     switch (s) {
@@ -27,10 +27,6 @@ namespace new_frontiers {
         float cargo;
 
         float energy;
-        float maxEnergy;
-        float refill;
-
-        float pheromonCost;
       };
 
       /**
@@ -47,23 +43,14 @@ namespace new_frontiers {
       getCarried() const noexcept;
 
       /**
-       * @brief - Implementation of the interface method to pause
-       *          the internal processes for this mob. Note that
-       *          it is mostly provided so that this class is not
-       *          abstract as there are not really any process to
-       *          pause at this time.
-       * @param t - the timestamp at which the pause occur.
+       * @brief - Drop some of the cargo carried by the mob, for
+       *          example because it was not granted as much as
+       *          it requested when harvesting a deposit.
+       * @param cargo - the amount of cargo to drop.
+       * @return - the amount actually dropped.
        */
-      void
-      pause(const utils::TimeStamp& t) override;
-
-      /**
-       * @brief - Implementation of the interface method to resume
-       *          the internal processes for this mob.
-       * @param t - the timestamp at which the resume occur.
-       */
-      void
-      resume(const utils::TimeStamp& t) override;
+      float
+      unload(float cargo) noexcept;
 
     protected:
 
@@ -280,11 +267,29 @@ namespace new_frontiers {
        */
       bool
       returnToWandering(StepInfo& info,
-                        std::function<bool(VFXShPtr)> filter,
+                        std::function<bool(const VFX&)> filter,
                         PheromonAnalyzer& analyzer,
                         path::Path& path,
                         unsigned attempts = 10u);
 
+      /**
+       * @brief - The energy available for this mob to take
+       *          actions. It is read from the components if
+       *          the mob is attached to some.
+       * @return - the energy of the mob.
+       */
+      float
+      energy() const noexcept;
+
+      /**
+       * @brief - Consume some energy of this mob, either in
+       *          the mob or in the components it is attached
+       *          to.
+       * @param amount - the energy to consume.
+       */
+      void
+      spend(float amount) noexcept;
+
       /**
        * @brief - Used to pick a semi-random target based on
        *          the pheromons that are visible from the
@@ -316,11 +321,13 @@ namespace new_frontiers {
        *          which pheromones are relevant according to
        *          the goal of the mob.
        * @param goal - the goal of the wandering process.
+       * @param arena - the memory resource of the analyzer.
        * @return - a pheromon analyzer that will be able to
        *           weigh the pheromons based on the goal.
        */
       virtual PheromonAnalyzer
-      generateFromGoal(const Goal& goal) noexcept = 0;
+      generateFromGoal(const Goal& goal,
+                       std::pmr::memory_resource* arena) noexcept = 0;
 
     private:
 
@@ -340,7 +347,7 @@ namespace new_frontiers {
       behaviorToPheromon(const Behavior& b) noexcept;
 
       void
-      emitPheromon(StepInfo& info) noexcept;
+      emitPheromon(StepInfo& info);
 
       /**
        * @brief - Dispatch method which will analyze the current state
@@ -353,6 +360,53 @@ namespace new_frontiers {
       Thought
       behave(StepInfo& info, const path::Path& path) noexcept;
 
+      /**
+       * @brief - Determine whether this mob should re-evaluate its
+       *          behavior during this step. Between evaluations a
+       *          mob only follows its current path.
+       * @param info - information about the surroundings of the mob.
+       * @return - `true` if the behavior should be evaluated.
+       */
+      bool
+      shouldThink(const StepInfo& info) noexcept;
+
+      /**
+       * @brief - Schedule the next evaluation of the behavior based
+       *          on the state of the mob after the current one and
+       *          on whether enemies are within its perception. The
+       *          delay is jittered so that evaluations of the mobs
+       *          are spread across ticks.
+       * @param info - information about the surroundings of the mob.
+       */
+      void
+      scheduleThink(StepInfo& info) noexcept;
+
+    private:
+
+      /**
+       * @brief - The delay in seconds between two evaluations of
+       *          the behavior for a mob following a path.
+       */
+      static const float sk_thinkEnRoute;
+
+      /**
+       * @brief - The delay in seconds between two evaluations of
+       *          the behavior for a mob without a path to follow.
+       */
+      static const float sk_thinkIdle;
+
+      /**
+       * @brief - The maximum delay in seconds between evaluations
+       *          of the behavior for a mob displayed on screen.
+       */
+      static const float sk_thinkOnScreen;
+
+      /**
+       * @brief - The delay in seconds between evaluations of the
+       *          behavior for a mob perceiving enemies.
+       */
+      static const float sk_thinkNearEnemies;
+
     protected:
 
       /**
@@ -383,33 +437,31 @@ namespace new_frontiers {
       float m_energy;
 
       /**
-       * @brief - Measure the maximum energy that this mob can
-       *          have. Above this value the energy won't be
-       *          refilled anymore.
+       * @brief - Describe the current behavior for this entity. It
+       *          is changed dynamically based on the surrounding
+       *          elements.
+       *          Each behavior will lead to different actions that
+       *          can be performed by the entity.
        */
-      float m_maxEnergy;
+      Behavior m_behavior;
 
-      /**
-       * @brief - Indication of how fast the energy pool of
-       *          this entity can be refilled over time. A
-       *          faster refill rate indicates an entity that
-       *          can take more decisions.
-       */
-      float m_energyRefill;
+    private:
 
       /**
-       * @brief - The cost in energy of spawning a phgeromon.
+       * @brief - The remaining duration in seconds before the next
+       *          evaluation of the behavior of this mob.
        */
-      float m_pheromonCost;
+      float m_thinkDelay;
 
       /**
-       * @brief - Describe the current behavior for this entity. It
-       *          is changed dynamically based on the surrounding
-       *          elements.
-       *          Each behavior will lead to different actions that
-       *          can be performed by the entity.
+       * @brief - Whether the last evaluation of the behavior left
+       *          this mob without a path to follow. If it is not
+       *          the case, reaching the end of the path triggers
+       *          a new evaluation right away.
        */
-      Behavior m_behavior;
+      bool m_idle;
+
+      friend class Components;
   };
 
   using MobShPtr = std::shared_ptr<Mob>;
@@ -18,15 +18,12 @@ namespace new_frontiers {
   }
 
   inline
-  void
-  Mob::pause(const utils::TimeStamp& /*t*/) {
-    // Nothing to do.
-  }
+  float
+  Mob::unload(float cargo) noexcept {
+    float dropped = std::min(std::max(cargo, 0.0f), m_carrying);
+    m_carrying -= dropped;
 
-  inline
-  void
-  Mob::resume(const utils::TimeStamp& /*t*/) {
-    // Nothing to do.
+    return dropped;
   }
 
   inline
@@ -65,8 +62,38 @@ namespace new_frontiers {
 
     // Also update the energy available for
     // this frame based on the elapsed time
-    // since the last update.
-    m_energy = std::min(m_energy + info.elapsed * m_energyRefill, m_maxEnergy);
+    // since the last update: the components
+    // already did it for attached mobs.
+    if (!isAttached()) {
+      m_energy = std::min(m_energy + info.elapsed * getArchetype().refill, getArchetype().maxEnergy);
+    }
+  }
+
+  inline
+  float
+  Mob::energy() const noexcept {
+    return (m_components != nullptr ? m_components->energy(m_slot) : m_energy);
+  }
+
+  inline
+  void
+  Mob::spend(float amount) noexcept {
+    if (m_components != nullptr) {
+      m_components->spend(m_slot, amount);
+      return;
+    }
+
+    m_energy -= amount;
+  }
+
+  inline
+  bool
+  Mob::shouldThink(const StepInfo& info) noexcept {
+    m_thinkDelay -= info.elapsed;
+
+    // Reaching the end of the path requires a decision
+    // to be taken right away.
+    return m_thinkDelay <= 0.0f || (!m_idle && !isEnRoute());
   }
 
   inline
@@ -145,14 +172,14 @@ namespace new_frontiers {
 
   inline
   void
-  Mob::emitPheromon(StepInfo& info) noexcept {
+  Mob::emitPheromon(StepInfo& info) {
     // Emit a pheromon based on the current behavior
     // if the energy is available.
-    if (m_energy >= m_pheromonCost && !inhibitPheromon(info)) {
+    if (energy() >= getArchetype().pheromonCost && !inhibitPheromon(info)) {
       pheromon::Type pt = behaviorToPheromon(m_behavior);
       info.spawnVFX(spawnPheromon(pt));
 
-      m_energy -= m_pheromonCost;
+      spend(getArchetype().pheromonCost);
     }
   }
 
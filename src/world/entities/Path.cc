@@ -98,7 +98,7 @@ namespace new_frontiers {
       // First, try to find a straight path to the
       // target: if this is possible it's cool.
       utils::Point2f obsP;
-      std::vector<utils::Point2f> iPoints;
+      std::pmr::vector<utils::Point2f> iPoints(info.arena);
 
       bool obs = info.frustum->obstructed(s, xDir, yDir, d, iPoints, &obsP);
       bool obsWithinTarget = obs && (std::abs(obsP.x() - p.x()) < 1.0f && std::abs(obsP.y() - p.y()) < 1.0f);
@@ -133,8 +133,8 @@ namespace new_frontiers {
       // desired (the A*) as it means that each mob
       // has indeed infinite vision for now but
       // that's it.
-      AStar alg(s, p, info.frustum);
-      std::vector<utils::Point2f> steps;
+      AStar alg(s, p, info.frustum, info.arena);
+      std::pmr::vector<utils::Point2f> steps(info.arena);
 
       if (!alg.findPath(steps, maxDistanceFromStart, allowLog)) {
         return false;
@@ -1,6 +1,7 @@
 #ifndef    PATH_HH
 # define   PATH_HH
 
+# include <memory_resource>
 # include "StepInfo.hh"
 # include <maths_utils/Point2.hh>
 
@@ -38,7 +39,11 @@ namespace new_frontiers {
 
     /**
      * @brief - Define a complete path, composed of one or
-     *          more segments.
+     *          more segments. Candidate paths built during a
+     *          step draw their memory from the arena of the
+     *          step: they are copied into the path of the
+     *          entity when selected, and should never be
+     *          swapped with it.
      */
     struct Path {
       utils::Point2f home;
@@ -46,9 +51,9 @@ namespace new_frontiers {
       utils::Point2f cur;
       int seg;
 
-      std::vector<Segment> segments;
+      std::pmr::vector<Segment> segments;
 
-      std::vector<utils::Point2f> cPoints;
+      std::pmr::vector<utils::Point2f> cPoints;
 
       bool forced;
 
@@ -215,10 +220,12 @@ namespace new_frontiers {
      * @brief - Create a new path with the input position
      *          as default.
      * @param p - the input position of the path.
+     * @param arena - the memory resource of the path.
      * @return - the created path.
      */
     Path
-    newPath(const utils::Point2f& p) noexcept;
+    newPath(const utils::Point2f& p,
+            std::pmr::memory_resource* arena = std::pmr::get_default_resource()) noexcept;
 
   }
 }
@@ -171,17 +171,20 @@ namespace new_frontiers {
 
     inline
     Path
-    newPath(const utils::Point2f& p) noexcept {
-      Path pa;
+    newPath(const utils::Point2f& p,
+            std::pmr::memory_resource* arena) noexcept
+    {
+      Path pa{
+        p,
+        p,
+        -1,
+        std::pmr::vector<Segment>(arena),
+        std::pmr::vector<utils::Point2f>(arena),
+        false
+      };
 
-      pa.home = p;
-      pa.cur = p;
-
-      pa.seg = -1;
       pa.addPassagePoint(p);
 
-      pa.forced = false;
-
       return pa;
     }
 
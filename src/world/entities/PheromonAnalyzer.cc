@@ -1,16 +1,18 @@
 
 # include "PheromonAnalyzer.hh"
+# include <numeric>
 # include <algorithm>
+# include "Logging.hh"
 
 namespace new_frontiers {
 
-  PheromonAnalyzer::PheromonAnalyzer():
+  PheromonAnalyzer::PheromonAnalyzer(std::pmr::memory_resource* arena):
     utils::CoreObject("analyzer"),
 
-    m_weights(),
+    m_weights(arena),
     m_rndWeight(),
 
-    m_info()
+    m_info(arena)
   {
     setService("pheromons");
 
@@ -22,7 +24,7 @@ namespace new_frontiers {
     // Make a copy of the pheromons accumulated so far.
     // This will allow to keep it intact in case more
     // than a single target needs to be computed.
-    std::unordered_map<pheromon::Type, PheromonInfo> pheromons = m_info;
+    std::pmr::unordered_map<pheromon::Type, PheromonInfo> pheromons(m_info, m_info.get_allocator());
 
     // Compute whether or not some pheromons have been
     // accumulated so far. We will also report info on
@@ -120,7 +122,7 @@ namespace new_frontiers {
     x /= totW;
     y /= totW;
 
-    verbose(
+    NF_VERBOSE(
       "rn: " + std::to_string(xRnd) + "x" +  std::to_string(yRnd) +
       ", ch: " + std::to_string(pheromons[pheromon::Type::Chase].x) + "x" +
       std::to_string(pheromons[pheromon::Type::Chase].y) +
@@ -2,6 +2,7 @@
 # define   PHEROMON_ANALYZER_HH
 
 # include <unordered_map>
+# include <memory_resource>
 # include <core_utils/CoreObject.hh>
 # include "../effects/Pheromon.hh"
 
@@ -17,9 +18,13 @@ namespace new_frontiers {
        *          used to weigh the relative importance of
        *          various pheromons in the decision making
        *          process.
-       * @param props - the properties describing this mob.
+       *          The analyzer is meant to be transient: its data is
+       *          allocated from the input memory resource, which is
+       *          typically the arena of the current step.
+       * @param arena - the memory resource of the analyzer.
        */
-      PheromonAnalyzer();
+      explicit
+      PheromonAnalyzer(std::pmr::memory_resource* arena = std::pmr::get_default_resource());
 
       /**
        * @brief - Define a new weight for the pheromon associated
@@ -105,10 +110,10 @@ namespace new_frontiers {
       /**
        * @brief - Convenience using to define iterators.
        */
-      using CInfoIt = std::unordered_map<pheromon::Type, PheromonInfo>::const_iterator;
-      using InfoIt = std::unordered_map<pheromon::Type, PheromonInfo>::iterator;
-      using CWIt = std::unordered_map<pheromon::Type, float>::const_iterator;
-      using WIt = std::unordered_map<pheromon::Type, float>::iterator;
+      using CInfoIt = std::pmr::unordered_map<pheromon::Type, PheromonInfo>::const_iterator;
+      using InfoIt = std::pmr::unordered_map<pheromon::Type, PheromonInfo>::iterator;
+      using CWIt = std::pmr::unordered_map<pheromon::Type, float>::const_iterator;
+      using WIt = std::pmr::unordered_map<pheromon::Type, float>::iterator;
 
       /**
        *  @brief - Convenience define to refer to the key
@@ -124,7 +129,7 @@ namespace new_frontiers {
        *          This allows to adapt the importance of each
        *          type of external stimulus as needed.
        */
-      std::unordered_map<pheromon::Type, float> m_weights;
+      std::pmr::unordered_map<pheromon::Type, float> m_weights;
 
       /**
        * @brief - The relative weight of randomness in the
@@ -139,7 +144,7 @@ namespace new_frontiers {
        *          the surroundings of the element attached to
        *          this analyzer.
        */
-      std::unordered_map<pheromon::Type, PheromonInfo> m_info;
+      std::pmr::unordered_map<pheromon::Type, PheromonInfo> m_info;
   };
 
 }
@@ -13,8 +13,7 @@ namespace new_frontiers {
     m_exhaustion(props.exhaustion),
     m_recovery(props.recovery),
 
-    m_origin(),
-    m_remaining()
+    m_origin()
   {
     m_speed = m_sprintSpeed / 2.0f;
   }
@@ -28,6 +27,10 @@ namespace new_frontiers {
     // make controls move in both directions
     // to be intuitive.
 
+    // The motion is applied on the path so that
+    // it is only published upon calling the
+    // `commit` method.
+
     // Determine the speed of the player based
     // on the current state.
     float sp = m_speed;
@@ -41,45 +44,45 @@ namespace new_frontiers {
     if (info.controls.keys[MoveRight]) {
       // Right is moving along the negative
       // `x` axis and conversely.
-      m_tile.p.x() -= info.elapsed * std::sqrt(sp);
-      m_tile.p.y() += info.elapsed * std::sqrt(sp);
+      m_path.cur.x() -= info.elapsed * std::sqrt(sp);
+      m_path.cur.y() += info.elapsed * std::sqrt(sp);
     }
 
     if (info.controls.keys[MoveUp]) {
       // Up is moving along the negative
       // `y` axis and conversely.
-      m_tile.p.y() -= info.elapsed * std::sqrt(sp);
-      m_tile.p.x() -= info.elapsed * std::sqrt(sp);
+      m_path.cur.y() -= info.elapsed * std::sqrt(sp);
+      m_path.cur.x() -= info.elapsed * std::sqrt(sp);
     }
 
     if (info.controls.keys[MoveLeft]) {
-      m_tile.p.x() += info.elapsed * std::sqrt(sp);
-      m_tile.p.y() -= info.elapsed * std::sqrt(sp);
+      m_path.cur.x() += info.elapsed * std::sqrt(sp);
+      m_path.cur.y() -= info.elapsed * std::sqrt(sp);
     }
 
     if (info.controls.keys[MoveDown]) {
-      m_tile.p.y() += info.elapsed * std::sqrt(sp);
-      m_tile.p.x() += info.elapsed * std::sqrt(sp);
+      m_path.cur.y() += info.elapsed * std::sqrt(sp);
+      m_path.cur.x() += info.elapsed * std::sqrt(sp);
     }
 
     // Update the state of the player if he's
     // currently recovering or sprinting.
     if (m_state.exhausted && m_origin + m_recovery <= info.moment) {
       m_state.exhausted = false;
-      debug("Player is not exhausted anymore");
+      NF_DEBUG("Player is not exhausted anymore");
     }
     if (m_state.glowing && m_origin + m_exhaustion <= info.moment) {
       m_state.glowing = false;
       m_state.exhausted = true;
       m_origin = info.moment;
-      debug("Player is now exhausted (and no more glowing)");
+      NF_DEBUG("Player is now exhausted (and no more glowing)");
     }
 
     // Update the sprinting status.
     if (info.controls.keys[Sprint] && !m_state.glowing && !m_state.exhausted) {
       m_state.glowing = true;
       m_origin = info.moment;
-      debug("Player is now glowing");
+      NF_DEBUG("Player is now glowing");
     }
   }
 
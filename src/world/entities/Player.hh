@@ -38,24 +38,6 @@ namespace new_frontiers {
       void
       step(StepInfo& info) override;
 
-      /**
-       * @brief - Implementation of the interface method to pause
-       *          the internal processes for this player. It mostly
-       *          include freezing the state of the player.
-       * @param t - the timestamp at which the pause occur.
-       */
-      void
-      pause(const utils::TimeStamp& t) override;
-
-      /**
-       * @brief - Implementation of the interface method to resume
-       *          the internal processes for this player. Resuming
-       *          the state to a valid configuration is involved.
-       * @param t - the timestamp at which the resume occur.
-       */
-      void
-      resume(const utils::TimeStamp& t) override;
-
     protected:
 
       /**
@@ -117,14 +99,6 @@ namespace new_frontiers {
        *          a recovery or a sprinting phase.
        */
       utils::TimeStamp m_origin;
-
-      /**
-       * @brief - A duration that represents the remaining
-       *          duration for any effect that this player
-       *          might be submitted to when a pause event
-       *          occurs.
-       */
-      utils::Duration m_remaining;
   };
 
   using PlayerShPtr = std::shared_ptr<Player>;
@@ -10,17 +10,16 @@ namespace new_frontiers {
   Warrior::Warrior(const WProps& props):
     Mob(props),
 
-    m_attack(props.attack),
-    m_attackCost(props.attackCost),
-    m_attackRange(props.attackRange),
-
-    m_seekForHealthThreshold(props.seekForHealth)
+    m_attack(props.attack)
   {
-    setService("warrior");
+    static const ElementLogger& logger = ElementLogger::get(getName(), "warrior");
+    setLogger(logger);
   }
 
   bool
   Warrior::chase(StepInfo& info, path::Path& path) {
+    const Archetype& a = getArchetype();
+
     // In chase mode we need to pick the closest entity
     // and set its current position as the new target
     // for this entity.
@@ -28,53 +27,64 @@ namespace new_frontiers {
     // to the wandering behavior.
     world::Filter f{getOwner(), false};
     tiles::Entity* te = nullptr;
-    std::vector<EntityShPtr> entities = info.frustum->getVisible(
+    std::pmr::vector<EntityHandle> entities = info.frustum->getVisible(
       m_tile.p,
-      m_perceptionRadius,
+      a.perception,
       te,
       -1,
       &f,
-      world::Sort::Distance
+      world::Sort::Distance,
+      info.arena
     );
 
     if (entities.empty()) {
       // Couldn't find the entity we were chasing, get
       // back to wander behavior.
-      debug("Lost entity at " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()));
+      NF_DEBUG("Lost entity at " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()));
 
       pickTargetFromPheromon(info, path, Goal::Entity);
       return true;
     }
 
     // Pick the first one as it will be the closest.
-    EntityShPtr e = entities.front();
+    Entity* e = info.frustum->resolve(entities.front());
+    if (e == nullptr) {
+      // The entity is not valid anymore, get back to
+      // wander behavior.
+      pickTargetFromPheromon(info, path, Goal::Entity);
+      return true;
+    }
 
     // Update the target with the actual position of
     // the entity: indeed the entity may be moving
     // so we want to accurately chase it.
     path.clear(m_tile.p);
-    if (!path.generatePathTo(info, e->getTile().p, false, m_perceptionRadius)) {
+    if (!path.generatePathTo(info, e->getTile().p, false, a.perception)) {
       // Couldn't reach the entity, return to wandering.
-      debug("Entity is now unreachable, returning to wandering from " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()));
+      NF_DEBUG("Entity is now unreachable, returning to wandering from " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()));
       pickTargetFromPheromon(info, path, Goal::Entity);
       return true;
     }
 
     // In case we are close enough of the entity to
     // actually hit it, do so if we are able to.
-    if (m_energy >= m_attackCost && utils::d(e->getTile().p, m_tile.p) < m_attackRange) {
-      bool alive = e->damage(m_attack);
-      debug("Attacking for " + std::to_string(m_attack) + " damage, " + std::to_string(e->getHealthRatio()) + " health ratio");
+    if (energy() >= a.attackCost && utils::d(e->getTile().p, m_tile.p) < a.attackRange) {
+      // The damage is applied once all entities have
+      // been stepped, along with the ones dealt by any
+      // other entity: the target is removed then if it
+      // dies. We only predict whether this attack is
+      // enough to kill it.
+      info.damage(entities.front(), m_attack);
+      bool alive = (e->getHealth() > m_attack);
 
-      m_energy -= m_attackCost;
+      NF_DEBUG("Attacking for " + std::to_string(m_attack) + " damage, " + std::to_string(e->getHealth()) + " health left");
 
-      // Mark the entity for deletion in case it is
-      // now dead. We will also return back to the
-      // wandering behavior.
-      if (!alive) {
-        debug("Killed entity at " + std::to_string(e->getTile().p.x()) + "x" + std::to_string(e->getTile().p.y()));
+      spend(a.attackCost);
 
-        info.removeEntity(e.get());
+      // Return back to the wandering behavior in case
+      // the entity should be dead.
+      if (!alive) {
+        NF_DEBUG("Killed entity at " + std::to_string(e->getTile().p.x()) + "x" + std::to_string(e->getTile().p.y()));
 
         // Now we would like to either get back to
         // the colony in case the entity has lost
@@ -101,7 +111,8 @@ namespace new_frontiers {
     // We have reached home. Make sure that the
     // home still exists.
     world::Filter f{getOwner(), true};
-    BlockShPtr b = info.frustum->getClosest(m_tile.p, tiles::Portal, -1, -1, &f);
+    BlockHandle h = info.frustum->getClosest(m_tile.p, tiles::Portal, -1, -1, &f, info.arena);
+    Block* b = info.frustum->resolve(h);
 
     if (b == nullptr) {
       // For some reason the home of the entity does
@@ -110,7 +121,7 @@ namespace new_frontiers {
       return true;
     }
 
-    SpawnerOMeterShPtr s = std::dynamic_pointer_cast<SpawnerOMeter>(b);
+    SpawnerOMeter* s = dynamic_cast<SpawnerOMeter*>(b);
     if (s == nullptr) {
       // Not able to convert to a valid spawner,
       // use wander again.
@@ -126,49 +137,61 @@ namespace new_frontiers {
     }
 
     // Try to heal as much as possible in the limit of
-    // our own health pool.
+    // our own health pool. Other entities may draw from
+    // the spawner during this step: the resources are
+    // shared at the end of the step and we are healed
+    // then. We decide what to do next assuming we get
+    // everything we requested.
     float missing = m_totalHealth - m_health;
-    float gain = s->refill(-missing, false);
-    m_health += gain;
+    float stock = s->getStock();
+    float gain = std::min(missing, stock);
+
+    if (missing > 0.0f) {
+      info.refill(h, getHandle(), -missing);
+    }
 
-    debug("Healed for " + std::to_string(gain) + " (" + std::to_string(missing) + " was missing)");
+    float health = m_health + gain;
+    float ratio = (m_totalHealth > 0.0f ? health / m_totalHealth : 1.0f);
+    stock -= gain;
+
+    NF_DEBUG("Healed for " + std::to_string(gain) + " (" + std::to_string(missing) + " was missing)");
 
     // In case the home could not heal us enough, let's
     // pick a target not too far from the home and wait
     // for home to be filled again.
-    if (getHealthRatio() > m_seekForHealthThreshold) {
+    if (ratio > getArchetype().seekForHealth) {
       pickTargetFromPheromon(info, path, Goal::Entity);
       return true;
     }
 
     // Check whether the home has been refilled.
-    missing = std::max(m_totalHealth * m_seekForHealthThreshold - m_health, 0.0f);
-    if (s->getStock() > missing) {
+    missing = std::max(m_totalHealth * getArchetype().seekForHealth - health, 0.0f);
+    if (stock > missing) {
       path.clear(m_tile.p);
 
-      if (!path.generatePathTo(info, m_home, true, m_perceptionRadius)) {
-        debug("Failed to generate path to home even though it is refilled");
+      if (!path.generatePathTo(info, m_home, true, getArchetype().perception)) {
+        NF_DEBUG("Failed to generate path to home even though it is refilled");
         pickTargetFromPheromon(info, path, Goal::Home);
         return true;
       }
 
-      debug("Home is now refilled, going there");
+      NF_DEBUG("Home is now refilled, going there");
 
       return true;
     }
 
     utils::Point2f t;
-    pickRandomTarget(info, m_home, m_perceptionRadius, t.x(), t.y());
+    pickRandomTarget(info, m_home, getArchetype().perception, t.x(), t.y());
 
     path.clear(m_tile.p);
     if (!path.generatePathTo(info, t, false, utils::d(m_tile.p, t) + 1.0f)) {
       // Couldn't reach the entity, return to wandering.
-      debug("Failed to generate path to random target to stay close from home");
+      NF_DEBUG("Failed to generate path to random target to stay close from home");
       pickTargetFromPheromon(info, path, Goal::Home);
       return true;
     }
 
-    debug(
+    NF_DEBUG(
       "Not healed enough, going to " +
       std::to_string(t.x()) + "x" + std::to_string(t.y()) +
       " at " + std::to_string(utils::d(m_home, t)) + " from home"
@@ -181,10 +204,12 @@ namespace new_frontiers {
   Warrior::wander(StepInfo& info, path::Path& path) {
     // Depending on the status of the entity we will
     // prioritize a wandering behavior.
-    path::Path newPath = path::newPath(m_tile.p);
+    path::Path newPath = path::newPath(m_tile.p, info.arena);
     bool generated = false;
 
-    if (getHealthRatio() <= m_seekForHealthThreshold) {
+    float ratio = getHealthRatio();
+
+    if (ratio <= getArchetype().seekForHealth) {
       generated = wanderToHome(info, newPath);
     }
     else {
@@ -192,7 +217,7 @@ namespace new_frontiers {
     }
 
     if (generated) {
-      std::swap(path, newPath);
+      path = newPath;
       return true;
     }
 
@@ -213,8 +238,10 @@ namespace new_frontiers {
   }
 
   PheromonAnalyzer
-  Warrior::generateFromGoal(const Goal& goal) noexcept {
-    PheromonAnalyzer pa;
+  Warrior::generateFromGoal(const Goal& goal,
+                          std::pmr::memory_resource* arena) noexcept
+  {
+    PheromonAnalyzer pa(arena);
 
     switch (goal) {
       case Goal::Deposit:
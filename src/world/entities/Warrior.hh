@@ -16,10 +16,6 @@ namespace new_frontiers {
        */
       struct WProps: MProps {
         float attack;
-        float attackCost;
-        float attackRange;
-
-        float seekForHealth;
       };
 
       /**
@@ -49,7 +45,8 @@ namespace new_frontiers {
       inhibitPheromon(StepInfo& info) const noexcept override;
 
       PheromonAnalyzer
-      generateFromGoal(const Goal& goal) noexcept override;
+      generateFromGoal(const Goal& goal,
+                       std::pmr::memory_resource* arena) noexcept override;
 
     private:
 
@@ -58,30 +55,6 @@ namespace new_frontiers {
        *          attack will inflict that many damage.
        */
       float m_attack;
-
-      /**
-       * @brief - The cost in energy for an attack. It is
-       *          meant as a way to integrate the attack
-       *          in the thinking process of the warrior
-       *          and thus make some sort of concurrency
-       *          between the pheromon spawning and the
-       *          attack.
-       */
-      float m_attackCost;
-
-      /**
-       * @brief - Define the radius below which the entity
-       *          is able to hit another one. This can be
-       *          thought of as a range for this entity.
-       */
-      float m_attackRange;
-
-      /**
-       * @brief - Defines the percentage of health below
-       *          which this warrior is trying to get some
-       *          healing from its home.
-       */
-      float m_seekForHealthThreshold;
   };
 
   using WarriorShPtr = std::shared_ptr<Warrior>;
@@ -9,12 +9,10 @@
 namespace new_frontiers {
 
   Worker::Worker(const WProps& props):
-    Mob(props),
-
-    m_fleeRadiusThreshold(props.fleeRadius),
-    m_fleeConeAngleSpan(props.fleeConeSpan)
+    Mob(props)
   {
-    setService("worker");
+    static const ElementLogger& logger = ElementLogger::get(getName(), "worker");
+    setLogger(logger);
   }
 
   bool
@@ -40,7 +38,8 @@ namespace new_frontiers {
 
     // We have reached the deposit, attempt to pick
     // some resource and get back.
-    BlockShPtr b = info.frustum->getClosest(m_tile.p, tiles::Portal, m_perceptionRadius, 14);
+    BlockHandle h = info.frustum->getClosest(m_tile.p, tiles::Portal, getArchetype().perception, 14, nullptr, info.arena);
+    Block* b = info.frustum->resolve(h);
     if (b == nullptr) {
       // For some reason the deposit does not exist,
       // return to wandering.
@@ -48,7 +47,7 @@ namespace new_frontiers {
       return true;
     }
 
-    DepositShPtr d = std::dynamic_pointer_cast<Deposit>(b);
+    Deposit* d = dynamic_cast<Deposit*>(b);
     if (d == nullptr) {
       // Not able to convert to a valid deposit,
       // use wander again.
@@ -61,10 +60,20 @@ namespace new_frontiers {
     // Collect the maximum amount possible given
     // the stock of the deposit and the available
     // carrying capacity.
-    float toFetch = std::min(availableCargo(), d->getStock());
-    debug(
+    // The deposit might be harvested by other mobs
+    // during this step: the resources are shared at
+    // the end of the step and we will drop the part
+    // that was not granted to us.
+    float stock = d->getStock();
+    float toFetch = std::min(availableCargo(), stock);
+
+    if (toFetch > 0.0f) {
+      info.harvest(h, getHandle(), toFetch);
+    }
+
+    NF_DEBUG(
       "Collecting " +
-      std::to_string(toFetch) + "/" + std::to_string(d->getStock()) +
+      std::to_string(toFetch) + "/" + std::to_string(stock) +
       " on deposit at " +
       std::to_string(d->getTile().p.x()) + "x" + std::to_string(d->getTile().p.y())
     );
@@ -72,12 +81,11 @@ namespace new_frontiers {
     // In case we can't fetch anything, return to
     // wander behavior.
     if (toFetch <= 0.0f) {
-      debug("Deposit has been emptied while en route");
+      NF_DEBUG("Deposit has been emptied while en route");
       pickTargetFromPheromon(info, path, Goal::Deposit);
       return true;
     }
 
-    d->refill(-toFetch);
     carry(toFetch);
 
     // Now we would like to get back to the colony
@@ -114,7 +122,8 @@ namespace new_frontiers {
     // resource we're transporting and get back
     // to wandering.
     world::Filter f{getOwner(), true};
-    BlockShPtr b = info.frustum->getClosest(m_tile.p, tiles::Portal, -1, -1, &f);
+    BlockHandle h = info.frustum->getClosest(m_tile.p, tiles::Portal, -1, -1, &f, info.arena);
+    Block* b = info.frustum->resolve(h);
 
     if (b == nullptr) {
       // For some reason the home of the entity does
@@ -123,7 +132,7 @@ namespace new_frontiers {
       return true;
     }
 
-    SpawnerOMeterShPtr s = std::dynamic_pointer_cast<SpawnerOMeter>(b);
+    SpawnerOMeter* s = dynamic_cast<SpawnerOMeter*>(b);
     if (s == nullptr) {
       // Not able to convert to a valid spawner,
       // use wander again.
@@ -140,10 +149,14 @@ namespace new_frontiers {
 
     // Refill the home spawner with the amount we
     // scraped from the deposit.
-    debug("Refilling home with " + std::to_string(m_carrying) + " resource(s)");
-    s->refill(m_carrying);
+    NF_DEBUG("Refilling home with " + std::to_string(m_carrying) + " resource(s)");
+    info.refill(h, EntityHandle(), m_carrying);
     m_carrying = 0.0f;
 
+    // The spawner may be sleeping until it gets
+    // enough resources.
+    info.wakeBlock(h);
+
     // Re-wander again.
     pickTargetFromPheromon(info, path, Goal::Deposit);
     return true;
@@ -151,17 +164,20 @@ namespace new_frontiers {
 
   bool
   Worker::flee(StepInfo& info, path::Path& path) {
+    const Archetype& a = getArchetype();
+
     // Check whether there are some enemies close enough to
     // threaten us: this will trigger the escape behavior.
     world::Filter f{getOwner(), false};
     tiles::Entity* te = nullptr;
-    std::vector<EntityShPtr> enemies = info.frustum->getVisible(
+    std::pmr::vector<EntityHandle> enemies = info.frustum->getVisible(
       m_tile.p,
-      m_fleeRadiusThreshold,
+      a.fleeRadius,
       te,
       -1,
       &f,
-      world::Sort::Distance
+      world::Sort::Distance,
+      info.arena
     );
 
     if (enemies.empty()) {
@@ -181,13 +197,25 @@ namespace new_frontiers {
     };
 
     for (unsigned id = 0u ; id < enemies.size() ; ++id) {
-      float cw = weight(enemies[id]->getTile().p);
+      Entity* e = info.frustum->resolve(enemies[id]);
+      if (e == nullptr) {
+        continue;
+      }
 
-      g.x() += cw * enemies[id]->getTile().p.x();
-      g.y() += cw * enemies[id]->getTile().p.y();
+      const utils::Point2f& p = e->getTile().p;
+      float cw = weight(p);
+
+      g.x() += cw * p.x();
+      g.y() += cw * p.y();
       w += cw;
     }
 
+    // None of the enemies could be resolved: there
+    // is nothing to flee from anymore.
+    if (w <= 0.0f) {
+      return wander(info, path);
+    }
+
     g.x() /= w;
     g.y() /= w;
 
@@ -198,7 +226,7 @@ namespace new_frontiers {
       m_tile.p,
       m_tile.p.x() - g.x(),
       m_tile.p.y() - g.y(),
-      m_fleeConeAngleSpan,
+      a.fleeConeSpan,
       path.currentTarget()
     );
     if (isEnRoute() && (inCone || path.forced)) {
@@ -212,20 +240,20 @@ namespace new_frontiers {
     // will delete any existing planned path.
     float dToEnemy = utils::d(g, m_tile.p);
     float d = info.rng.rndFloat(dToEnemy, 2.0f * dToEnemy);
-    float theta = info.rng.rndAngle(0.0f, m_fleeConeAngleSpan);
+    float theta = info.rng.rndAngle(0.0f, a.fleeConeSpan);
 
     float baseAngle = utils::angleFromDirection(m_tile.p, g);
 
-    float xDir = std::cos(baseAngle + theta - m_fleeConeAngleSpan / 2.0f);
-    float yDir = std::sin(baseAngle + theta - m_fleeConeAngleSpan / 2.0f);
+    float xDir = std::cos(baseAngle + theta - a.fleeConeSpan / 2.0f);
+    float yDir = std::sin(baseAngle + theta - a.fleeConeSpan / 2.0f);
 
     // Clamp these coordinates and update the direction
     // based on that.
     info.clampPath(m_tile.p, xDir, yDir, d);
     utils::Point2f t(m_tile.p.x() + d * xDir, m_tile.p.y() + d * yDir);
 
-    path::Path newPath = path::newPath(m_tile.p);
-    bool generated = newPath.generatePathTo(info, t, false, m_perceptionRadius);
+    path::Path newPath = path::newPath(m_tile.p, info.arena);
+    bool generated = newPath.generatePathTo(info, t, false, a.perception);
 
     // There's one caveat with the approach to
     // flee in a general direction. By assuming
@@ -242,16 +270,16 @@ namespace new_frontiers {
     int tries = 10;
     while (!generated && tries > 0) {
       d = info.rng.rndFloat(dToEnemy, 2.0f * dToEnemy);
-      theta = info.rng.rndAngle(0.0f, m_fleeConeAngleSpan);
+      theta = info.rng.rndAngle(0.0f, a.fleeConeSpan);
 
-      xDir = std::cos(baseAngle + theta - m_fleeConeAngleSpan / 2.0f);
-      yDir = std::sin(baseAngle + theta - m_fleeConeAngleSpan / 2.0f);
+      xDir = std::cos(baseAngle + theta - a.fleeConeSpan / 2.0f);
+      yDir = std::sin(baseAngle + theta - a.fleeConeSpan / 2.0f);
 
       info.clampPath(m_tile.p, xDir, yDir, d);
       t = utils::Point2f(m_tile.p.x() + d * xDir, m_tile.p.y() + d * yDir);
 
       newPath.clear(m_tile.p);
-      generated = newPath.generatePathTo(info, t, false, m_perceptionRadius);
+      generated = newPath.generatePathTo(info, t, false, a.perception);
 
       --tries;
     }
@@ -264,12 +292,12 @@ namespace new_frontiers {
       tries = 10;
       while (!generated && tries > 0) {
         utils::Point2f t;
-        pickRandomTarget(info, m_tile.p, m_pathLength, t.x(), t.y());
+        pickRandomTarget(info, m_tile.p, a.pathLength, t.x(), t.y());
 
-        debug("Generated random target " + std::to_string(t.x()) + "x" + std::to_string(t.y()));
+        NF_DEBUG("Generated random target " + std::to_string(t.x()) + "x" + std::to_string(t.y()));
 
         newPath.clear(m_tile.p, true);
-        generated = newPath.generatePathTo(info, t, false, m_perceptionRadius);
+        generated = newPath.generatePathTo(info, t, false, a.perception);
         --tries;
       }
     }
@@ -277,7 +305,7 @@ namespace new_frontiers {
     if (!generated) {
       // Failed to generate a path from random
       // motion: let's give up.
-      debug(
+      NF_DEBUG(
         "Failed to escape from " +
         std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y())
       );
@@ -286,16 +314,16 @@ namespace new_frontiers {
       return false;
     }
 
-    debug(
+    NF_DEBUG(
       "Escaping " + std::to_string(g.x()) + "x" + std::to_string(g.y()) +
       " from " + std::to_string(m_tile.p.x()) + "x" + std::to_string(m_tile.p.y()) +
-      " in cone from " + std::to_string(180.0f * (baseAngle - m_fleeConeAngleSpan / 2.0f) / 3.14159f) +
-      " - " + std::to_string(180.0f * (baseAngle + m_fleeConeAngleSpan / 2.0f) / 3.14159f) +
+      " in cone from " + std::to_string(180.0f * (baseAngle - a.fleeConeSpan / 2.0f) / 3.14159f) +
+      " - " + std::to_string(180.0f * (baseAngle + a.fleeConeSpan / 2.0f) / 3.14159f) +
       " (d: " + std::to_string(utils::d(g, m_tile.p)) +
       ", forced: " + std::to_string(newPath.forced) + ")"
     );
 
-    std::swap(path, newPath);
+    path = newPath;
     setBehavior(Behavior::Flee);
 
     return true;
@@ -312,7 +340,7 @@ namespace new_frontiers {
 
     // Depending on the status of the entity we will
     // prioritize a wandering behavior.
-    path::Path newPath = path::newPath(m_tile.p);
+    path::Path newPath = path::newPath(m_tile.p, info.arena);
     bool generated = false;
 
     if (availableCargo() <= 0.0f) {
@@ -323,7 +351,7 @@ namespace new_frontiers {
     }
 
     if (generated) {
-      std::swap(path, newPath);
+      path = newPath;
       return true;
     }
 
@@ -344,8 +372,10 @@ namespace new_frontiers {
   }
 
   PheromonAnalyzer
-  Worker::generateFromGoal(const Goal& goal) noexcept {
-    PheromonAnalyzer pa;
+  Worker::generateFromGoal(const Goal& goal,
+                          std::pmr::memory_resource* arena) noexcept
+  {
+    PheromonAnalyzer pa(arena);
 
     switch (goal) {
       case Goal::Deposit:
@@ -400,13 +430,14 @@ namespace new_frontiers {
     // enough to threaten us.
     world::Filter f{getOwner(), false};
     tiles::Entity* te = nullptr;
-    std::vector<EntityShPtr> enemies = info.frustum->getVisible(
+    std::pmr::vector<EntityHandle> enemies = info.frustum->getVisible(
       m_tile.p,
-      m_fleeRadiusThreshold,
+      getArchetype().fleeRadius,
       te,
       -1,
       &f,
-      world::Sort::Distance
+      world::Sort::Distance,
+      info.arena
     );
 
     if (enemies.empty()) {
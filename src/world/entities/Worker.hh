@@ -14,10 +14,7 @@ namespace new_frontiers {
        *          as a way to reduce the number of arguments
        *          provided to the constructor of this class.
        */
-      struct WProps: MProps {
-        float fleeRadius;
-        float fleeConeSpan;
-      };
+      struct WProps: MProps {};
 
       /**
        * @brief - Creates a new mob with the specified props.
@@ -49,7 +46,8 @@ namespace new_frontiers {
       inhibitPheromon(StepInfo& info) const noexcept override;
 
       PheromonAnalyzer
-      generateFromGoal(const Goal& goal) noexcept override;
+      generateFromGoal(const Goal& goal,
+                       std::pmr::memory_resource* arena) noexcept override;
 
     private:
 
@@ -87,22 +85,6 @@ namespace new_frontiers {
        *          going to infinity.
        */
       static constexpr float sk_proximityAlert = 0.01f;
-
-      /**
-       * @brief - Defines the radius below which an entity
-       *          considers that it should flee.
-       */
-      float m_fleeRadiusThreshold;
-
-      /**
-       * @brief - Defines the width of the cone where the entity
-       *          is attempting to flee when enemies are detected.
-       *          This value is expressed in radians.
-       *          The larger this value the wider the cone to flee
-       *          will be, giving the entity less of an urge to
-       *          flee.
-       */
-      float m_fleeConeAngleSpan;
   };
 
   using WorkerShPtr = std::shared_ptr<Worker>;